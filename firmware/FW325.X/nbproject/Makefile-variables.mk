@@ -8,3 +8,7 @@ CND_BASEDIR=`pwd`
 CND_ARTIFACT_DIR_default=dist/default/production
 CND_ARTIFACT_NAME_default=FW325.X.production.hex
 CND_ARTIFACT_PATH_default=dist/default/production/FW325.X.production.hex
+# release configuration
+CND_ARTIFACT_DIR_release=dist/release/production
+CND_ARTIFACT_NAME_release=FW325.X.production.hex
+CND_ARTIFACT_PATH_release=dist/release/production/FW325.X.production.hex
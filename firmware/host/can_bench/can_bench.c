@@ -0,0 +1,587 @@
+/*!
+ * \defgroup hostCanBench Host CAN protocol benchmark
+ * \ingroup libraryModules
+ *
+ * # Overview
+ *
+ * This host program measures the MET CAN protocol engine
+ * (Shared/CAN/MET_can_protocol.c) without hardware.
+ *
+ * The library source is compiled unchanged against a host stand-in of the
+ * Harmony 3 definitions.h (see definitions.h in this directory):
+ * the CAN0 peripheral is replaced by an in-process virtual bus.
+ * The device Id and the number of STATUS, DATA and PARAM registers
+ * are taken from the FW325 application (Protocol/protocol.h).
+ *
+ * The virtual bus reproduces the target reception model:
+ * + the RX FIFO0 holds \ref BENCH_RX_FIFO0_ELEMENTS frames (1 on the FW325 target):
+ *   a frame arriving when the FIFO is full is lost (RX overrun);
+ * + a received frame is passed to the library only when the reception
+ *   has been re-armed with CAN0_MessageReceive(), as the RX interrupt does;
+ * + the TX FIFO holds \ref BENCH_TX_FIFO_ELEMENTS frames (TXBC.TFQS, 1 on the FW325 target):
+ *   an element is released only when its frame has been sent on the bus,
+ *   and a transmission with the FIFO full fails (TX FIFO full).
+ *
+ * ## Time model
+ *
+ * The benchmark runs on a simulated time base, so the results do not depend
+ * on the speed of the host CPU:
+ * + every main loop iteration of the device takes the loop time (option -l);
+ * + every frame occupies the bus for its bit time at the nominal bit rate (option -b),
+ *   with the worst case bit stuffing (\ref BENCH_FRAME_BITS);
+ * + the bus carries a frame at a time: the pending frames of the host and of the
+ *   device are sent in CAN Id priority order.
+ *
+ * The host CPU time spent into MET_Can_Protocol_Loop() is reported separately.
+ *
+ * ## Traffic
+ *
+ * The simulated host (MCPU) replays a realistic traffic mix:
+ * + STATUS register polls (rotating over all the STATUS registers);
+ * + COMMAND execution frames and COMMAND register polls;
+ * + DATA register writes;
+ * + Bootloader GET_INFO requests.
+ *
+ * The host keeps up to WINDOW requests outstanding (1 = strict request/response
+ * as done by the MCPU). Every request is time-stamped when it is queued for the bus
+ * and the latency is measured when its answer has been sent on the bus.
+ * A request not answered is counted as dropped.
+ *
+ * With the option -t the device also sends an Application stream frame
+ * (MET_Can_Protocol_SendStream()) at every main loop, as the event trace
+ * streaming does: the stream shall not cause the loss of any protocol answer.
+ *
+ * # Build and run
+ *
+ * From the firmware directory:
+ * ```text
+ * gcc -O1 -std=gnu99 -fshort-enums -Wall -Ihost/can_bench -Isrc -Isrc/Shared/CAN \
+ *     host/can_bench/can_bench.c src/Shared/CAN/MET_can_protocol.c -o can_bench
+ *
+ * ./can_bench [-n requests] [-w window] [-s seed] [-b kbit/s] [-l loop us] [-t]
+ * ```
+ *
+ * \note -fshort-enums is mandatory: XC32 (AAPCS) packs the enum types
+ * in the smallest integer and the protocol frames rely on it
+ * (the MET_Command_Register_t is copied as 5 bytes into the frame).
+ *
+ * The optimization level should match the one of the firmware build
+ * when comparing results before and after a protocol change.
+ *
+ *  @{
+ */
+
+#define _CAN_BENCH_C
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "definitions.h"
+#include "MET_can_protocol.h"
+#include "Protocol/protocol.h"
+
+#define BENCH_DEVICE_ID         MET_CAN_APP_DEVICE_ID       //!< Device Id of the FW325 application
+#define BENCH_STATUS_REGISTERS  MET_CAN_STATUS_REGISTERS    //!< STATUS register number of the FW325 application
+#define BENCH_DATA_REGISTERS    MET_CAN_DATA_REGISTERS      //!< DATA register number of the FW325 application
+#define BENCH_PARAM_REGISTERS   MET_CAN_PARAM_REGISTERS     //!< PARAM register number of the FW325 application
+
+/// Elements of the hardware RX FIFO0 (CAN_RXF0C.F0S)
+#define BENCH_RX_FIFO0_ELEMENTS (CAN0_RX_FIFO0_SIZE / CAN0_RX_FIFO0_ELEMENT_SIZE)
+
+/// Elements of the hardware TX FIFO (CAN_TXBC.TFQS)
+#define BENCH_TX_FIFO_ELEMENTS  (CAN0_TX_FIFO_BUFFER_SIZE / CAN0_TX_FIFO_BUFFER_ELEMENT_SIZE)
+
+#define BENCH_MAX_WINDOW        64      //!< Max number of outstanding requests
+#define BENCH_DRAIN_LOOPS       1000    //!< Loops without answer before a request is declared lost
+
+#define BENCH_BIT_RATE          1000    //!< Default CAN0 nominal bit rate (kbit/s)
+#define BENCH_LOOP_US           20      //!< Default main loop iteration time of the device (us)
+
+/// Bits of a standard data frame (11 bit Id) with the worst case stuffing, interframe space included
+#define BENCH_FRAME_BITS(len)   (47U + 8U * (len) + (34U + 8U * (len) - 1U) / 4U)
+
+/// Traffic mix in percent: the remaining part is made of STATUS polls
+#define BENCH_MIX_COMMAND       8       //!< COMMAND execution frames
+#define BENCH_MIX_READ_COMMAND  8       //!< COMMAND register polls
+#define BENCH_MIX_WRITE_DATA    4       //!< DATA register writes
+#define BENCH_MIX_BOOT_INFO     2       //!< Bootloader GET_INFO requests
+
+uint8_t host_seeprom[1024];
+uint8_t host_user_page[16] = {0,0,0,0, 0x11,0,0,0}; // SEESBLK = 1, SEEPSZ = 1
+uint8_t host_boot_ram[16];
+
+/// Virtual bus frame
+typedef struct{
+    uint32_t id;
+    uint8_t  len;
+    uint8_t  data[8];
+    uint64_t t;         //!< Simulated time the frame is ready to be sent, then the end of frame on the bus (ns)
+}BENCH_FRAME_t;
+
+/// Virtual CAN0 peripheral
+static struct{
+    BENCH_FRAME_t rx_fifo[BENCH_RX_FIFO0_ELEMENTS];
+    unsigned rx_count;
+
+    // Buffers armed by CAN0_MessageReceive()
+    bool      rx_armed;
+    uint32_t* rx_id;
+    uint8_t*  rx_len;
+    uint8_t*  rx_data;
+    uint16_t* rx_timestamp;
+
+    CAN_CALLBACK rx_callback;
+    uintptr_t    rx_context;
+
+    BENCH_FRAME_t tx_fifo[BENCH_TX_FIFO_ELEMENTS];
+    unsigned tx_count;
+}can0;
+
+/// Virtual bus
+static struct{
+    uint64_t now;       //!< Simulated time (ns)
+    uint64_t bit_ns;    //!< Bit time (ns)
+    uint64_t busy_ns;   //!< Time the bus has been carrying frames (ns)
+
+    bool busy;          //!< A frame is on the bus
+    bool from_host;     //!< The frame on the bus has been sent by the host
+    uint64_t end;       //!< End of the frame on the bus (ns)
+    uint64_t free;      //!< End of the last frame on the bus (ns)
+
+    BENCH_FRAME_t host_tx[BENCH_MAX_WINDOW]; //!< Host frames waiting for the bus
+    unsigned host_head;
+    unsigned host_count;
+}bus;
+
+/// Request types of the traffic mix
+typedef enum{
+    REQ_STATUS = 0,
+    REQ_COMMAND,
+    REQ_READ_COMMAND,
+    REQ_WRITE_DATA,
+    REQ_BOOT_INFO,
+    REQ_TYPES
+}BENCH_REQUEST_t;
+
+static const char* request_names[REQ_TYPES] = {"status poll", "command exec", "command poll", "data write", "boot info"};
+
+/// Outstanding request descriptor
+typedef struct{
+    uint32_t id;        //!< CAN Id of the request
+    uint8_t  key;       //!< seq byte (application) or command byte (bootloader)
+    uint64_t t_sent;    //!< simulated time the request has been queued for the bus
+}BENCH_PENDING_t;
+
+static struct{
+    BENCH_PENDING_t pending[BENCH_MAX_WINDOW];
+    unsigned head;
+    unsigned count;
+
+    unsigned long sent[REQ_TYPES];
+    unsigned long answered;
+    unsigned long rx_overrun;   //!< Requests lost because the RX FIFO was full
+    unsigned long tx_full;      //!< Transmissions refused because the TX FIFO was full
+    unsigned long unanswered;   //!< Requests never answered (RX overruns included)
+    unsigned long bus_frames;   //!< Frames exchanged on the bus
+    unsigned long stream_frames;//!< Application stream frames sent on the bus
+
+    uint64_t* latency;
+    unsigned long n_latency;
+}bench;
+
+static uint64_t now_ns(void){
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t) ts.tv_sec * 1000000000ULL + (uint64_t) ts.tv_nsec;
+}
+
+//_________________________________________________ VIRTUAL CAN0 ___________
+
+/**
+ * Passes the oldest frame of the RX FIFO to the armed reception buffers
+ * and executes the reception callback, as the CAN0 interrupt does.
+ */
+static void can0_rx_interrupt(void){
+    if((!can0.rx_armed) || (!can0.rx_count)) return;
+
+    BENCH_FRAME_t* frame = &can0.rx_fifo[0];
+    *can0.rx_id = frame->id;
+    *can0.rx_len = frame->len;
+    memcpy(can0.rx_data, frame->data, frame->len);
+    *can0.rx_timestamp = (uint16_t) (frame->t / bus.bit_ns);
+
+    can0.rx_count--;
+    memmove(&can0.rx_fifo[0], &can0.rx_fifo[1], can0.rx_count * sizeof(BENCH_FRAME_t));
+
+    can0.rx_armed = false;
+    if(can0.rx_callback) can0.rx_callback(can0.rx_context);
+}
+
+bool CAN0_MessageTransmit(uint32_t id, uint8_t length, uint8_t* data, CAN_MODE mode, CAN_MSG_TX_ATTRIBUTE msgAttr){
+    if(can0.tx_count >= BENCH_TX_FIFO_ELEMENTS){
+        bench.tx_full++;
+        return false;
+    }
+
+    BENCH_FRAME_t* frame = &can0.tx_fifo[can0.tx_count++];
+    frame->id = id;
+    frame->len = length;
+    frame->t = bus.now;
+    memcpy(frame->data, data, length);
+    return true;
+}
+
+bool CAN0_MessageReceive(uint32_t *id, uint8_t *length, uint8_t *data, uint16_t *timestamp, CAN_MSG_RX_ATTRIBUTE msgAttr, CAN_MSG_RX_FRAME_ATTRIBUTE *msgFrameAttr){
+    if(msgAttr != CAN_MSG_ATTR_RX_FIFO0) return false;
+
+    can0.rx_id = id;
+    can0.rx_len = length;
+    can0.rx_data = data;
+    can0.rx_timestamp = timestamp;
+    can0.rx_armed = true;
+
+    // A frame already waiting in the FIFO raises the interrupt immediately
+    can0_rx_interrupt();
+    return true;
+}
+
+uint32_t CAN0_TxFIFOFreeLevelGet(void){
+    return BENCH_TX_FIFO_ELEMENTS - can0.tx_count;
+}
+
+/// The timestamp counter counts the bit times, as TSCC.TSS = 1 with TCP = 0
+uint16_t CAN0_TimestampCounterGet(void){
+    return (uint16_t) (bus.now / bus.bit_ns);
+}
+
+CAN_ERROR CAN0_ErrorGet(void){
+    return CAN_ERROR_NONE;
+}
+
+bool CAN0_TxFIFOIsFull(void){
+    return (can0.tx_count >= BENCH_TX_FIFO_ELEMENTS);
+}
+
+void CAN0_MessageRAMConfigSet(uint8_t *msgRAMConfigBaseAddress){
+    return;
+}
+
+void CAN0_TxCallbackRegister(CAN_CALLBACK callback, uintptr_t contextHandle){
+    return;
+}
+
+void CAN0_RxCallbackRegister(CAN_CALLBACK callback, uintptr_t contextHandle, CAN_MSG_RX_ATTRIBUTE msgAttr){
+    if(msgAttr != CAN_MSG_ATTR_RX_FIFO0) return;
+    can0.rx_callback = callback;
+    can0.rx_context = contextHandle;
+}
+
+bool NVMCTRL_SmartEEPROM_IsBusy(void){
+    return false;
+}
+
+bool NVMCTRL_SmartEEPROM_IsActiveSectorFull(void){
+    return false;
+}
+
+void NVMCTRL_SmartEEPROMSectorReallocate(void){
+    return;
+}
+
+void NVIC_SystemReset(void){
+    fprintf(stderr, "NVIC_SystemReset() requested by the protocol\n");
+    exit(EXIT_FAILURE);
+}
+
+//_________________________________________________ SIMULATED APPLICATION ___
+
+/**
+ * Command handler of the simulated application:
+ * every command is immediately executed.
+ */
+static void bench_command_handler(uint8_t cmd, uint8_t d0, uint8_t d1, uint8_t d2, uint8_t d3){
+    if(cmd == MET_COMMAND_ABORT) MET_Can_Protocol_returnCommandAborted();
+    else MET_Can_Protocol_returnCommandExecuted(d0, d1);
+}
+
+//_________________________________________________ SIMULATED HOST _________
+
+/**
+ * Builds the next request of the traffic mix and queues it for the bus.
+ *
+ * @param type request type
+ * @param seq application frame sequence number
+ */
+static void host_send(BENCH_REQUEST_t type, uint8_t seq){
+    BENCH_FRAME_t frame;
+    uint8_t crc = 0;
+
+    memset(&frame, 0, sizeof(frame));
+    frame.len = 8;
+    frame.t = bus.now;
+    frame.id = _CAN_ID_BASE_ADDRESS + BENCH_DEVICE_ID;
+    frame.data[0] = seq;
+
+    switch(type){
+        case REQ_STATUS:
+            frame.data[1] = MET_CAN_PROTOCOL_READ_STATUS;
+            frame.data[2] = seq % BENCH_STATUS_REGISTERS;
+            break;
+        case REQ_COMMAND:
+            frame.data[1] = MET_CAN_PROTOCOL_COMMAND_EXEC;
+            frame.data[2] = 1 + (seq % 9);
+            frame.data[3] = seq;
+            break;
+        case REQ_READ_COMMAND:
+            frame.data[1] = MET_CAN_PROTOCOL_READ_COMMAND;
+            break;
+        case REQ_WRITE_DATA:
+            frame.data[1] = MET_CAN_PROTOCOL_WRITE_DATA;
+            frame.data[2] = 0;
+            frame.data[3] = seq;
+            break;
+        case REQ_BOOT_INFO:
+            frame.id = _CAN_ID_BOOTLOADER_ADDRESS + BENCH_DEVICE_ID;
+            frame.data[0] = BOOTLOADER_GET_INFO;
+            break;
+        default:
+            break;
+    }
+
+    if(frame.id >= _CAN_ID_BASE_ADDRESS){
+        for(int i=0; i<7; i++) crc ^= frame.data[i];
+        frame.data[7] = crc;
+    }
+
+    bench.sent[type]++;
+
+    bus.host_tx[(bus.host_head + bus.host_count) % BENCH_MAX_WINDOW] = frame;
+    bus.host_count++;
+
+    BENCH_PENDING_t* p = &bench.pending[(bench.head + bench.count) % BENCH_MAX_WINDOW];
+    p->id = frame.id;
+    p->key = frame.data[0];
+    p->t_sent = bus.now;
+    bench.count++;
+}
+
+/**
+ * Stores a request sent on the bus into the RX FIFO of the device.
+ *
+ * @param frame received frame
+ */
+static void host_deliver(BENCH_FRAME_t* frame){
+
+    // Hardware FIFO full: the frame is lost
+    if(can0.rx_count >= BENCH_RX_FIFO0_ELEMENTS){
+        bench.rx_overrun++;
+        return;
+    }
+
+    can0.rx_fifo[can0.rx_count++] = *frame;
+    can0_rx_interrupt();
+}
+
+/**
+ * Matches a frame sent by the device with the outstanding requests.
+ *
+ * The device answers in order: a pending request older than
+ * the answered one has been lost.
+ *
+ * @param frame answer frame
+ */
+static void host_receive(BENCH_FRAME_t* frame){
+    while(bench.count){
+        BENCH_PENDING_t* p = &bench.pending[bench.head];
+        bench.head = (bench.head + 1) % BENCH_MAX_WINDOW;
+        bench.count--;
+
+        if((p->id == frame->id) && (p->key == frame->data[0])){
+            bench.latency[bench.n_latency++] = frame->t - p->t_sent;
+            bench.answered++;
+            return;
+        }
+        bench.unanswered++;
+    }
+}
+
+//_________________________________________________ VIRTUAL BUS ____________
+
+/**
+ * Runs the bus until the current simulated time.
+ *
+ * A completed frame is delivered to the receiver
+ * (the device RX FIFO or the simulated host) and the TX FIFO element
+ * of a device frame is released. The next frame is then selected
+ * in CAN Id priority order between the host and the device queues
+ * and starts when the bus is free and the frame is ready.
+ */
+static void bus_run(void){
+    uint64_t t;
+
+    for(;;){
+        if(bus.busy){
+            if(bus.end > bus.now) return;
+
+            bus.busy = false;
+            bench.bus_frames++;
+            t = bus.end;
+            bus.free = t;
+
+            if(bus.from_host){
+                BENCH_FRAME_t* frame = &bus.host_tx[bus.host_head];
+                bus.host_head = (bus.host_head + 1) % BENCH_MAX_WINDOW;
+                bus.host_count--;
+                frame->t = t;
+                host_deliver(frame);
+            }else{
+                BENCH_FRAME_t frame = can0.tx_fifo[0];
+                can0.tx_count--;
+                memmove(&can0.tx_fifo[0], &can0.tx_fifo[1], can0.tx_count * sizeof(BENCH_FRAME_t));
+                frame.t = t;
+                if(frame.id == _CAN_ID_STREAM_BASE_ADDRESS + BENCH_DEVICE_ID) bench.stream_frames++;
+                else host_receive(&frame);
+            }
+        }
+
+        // Arbitration: the lowest CAN Id wins
+        BENCH_FRAME_t* next;
+        if(bus.host_count && ((!can0.tx_count) || (bus.host_tx[bus.host_head].id < can0.tx_fifo[0].id))){
+            next = &bus.host_tx[bus.host_head];
+            bus.from_host = true;
+        }else if(can0.tx_count){
+            next = &can0.tx_fifo[0];
+            bus.from_host = false;
+        }else return;
+
+        uint64_t frame_ns = BENCH_FRAME_BITS(next->len) * bus.bit_ns;
+        bus.busy = true;
+        bus.end = ((next->t > bus.free) ? next->t : bus.free) + frame_ns;
+        bus.busy_ns += frame_ns;
+    }
+}
+
+static int compare_u64(const void* a, const void* b){
+    uint64_t x = *(const uint64_t*) a;
+    uint64_t y = *(const uint64_t*) b;
+    return (x > y) - (x < y);
+}
+
+static uint64_t percentile(double p){
+    if(!bench.n_latency) return 0;
+    unsigned long i = (unsigned long) (p * (double) (bench.n_latency - 1) / 100.0);
+    return bench.latency[i];
+}
+
+int main(int argc, char** argv){
+    unsigned long requests = 100000;
+    unsigned window = 1;
+    unsigned seed = 1;
+    unsigned bit_rate = BENCH_BIT_RATE;
+    unsigned loop_us = BENCH_LOOP_US;
+    bool stream = false;
+    uint8_t stream_frame[8] = {0};
+    int opt;
+
+    while((opt = getopt(argc, argv, "n:w:s:b:l:t")) != -1){
+        switch(opt){
+            case 'n': requests = strtoul(optarg, NULL, 0); break;
+            case 'w': window = (unsigned) strtoul(optarg, NULL, 0); break;
+            case 's': seed = (unsigned) strtoul(optarg, NULL, 0); break;
+            case 'b': bit_rate = (unsigned) strtoul(optarg, NULL, 0); break;
+            case 'l': loop_us = (unsigned) strtoul(optarg, NULL, 0); break;
+            case 't': stream = true; break;
+            default:
+                fprintf(stderr, "usage: %s [-n requests] [-w window 1..%d] [-s seed] [-b kbit/s] [-l loop us] [-t]\n", argv[0], BENCH_MAX_WINDOW);
+                return EXIT_FAILURE;
+        }
+    }
+    if((window == 0) || (window > BENCH_MAX_WINDOW) || (requests == 0) ||
+       (bit_rate == 0) || (bit_rate > 1000) || (loop_us == 0)){
+        fprintf(stderr, "invalid arguments\n");
+        return EXIT_FAILURE;
+    }
+
+    bench.latency = malloc(requests * sizeof(uint64_t));
+    if(!bench.latency) return EXIT_FAILURE;
+    srand(seed);
+
+    bus.bit_ns = 1000000ULL / bit_rate;
+
+    MET_Can_Protocol_Init(BENCH_DEVICE_ID, BENCH_STATUS_REGISTERS, BENCH_DATA_REGISTERS, BENCH_PARAM_REGISTERS, 1, 0, 0, bench_command_handler);
+
+    unsigned long issued = 0;
+    unsigned long idle_loops = 0;
+    unsigned long loops = 0;
+    uint64_t cpu_ns = 0;
+    uint8_t seq = 0;
+
+    while((issued < requests) || (bench.count)){
+
+        // Host side: keeps the window full
+        while((issued < requests) && (bench.count < window)){
+            int r = rand() % 100;
+            BENCH_REQUEST_t type = REQ_STATUS;
+            if(r < BENCH_MIX_BOOT_INFO) type = REQ_BOOT_INFO;
+            else if(r < BENCH_MIX_BOOT_INFO + BENCH_MIX_WRITE_DATA) type = REQ_WRITE_DATA;
+            else if(r < BENCH_MIX_BOOT_INFO + BENCH_MIX_WRITE_DATA + BENCH_MIX_READ_COMMAND) type = REQ_READ_COMMAND;
+            else if(r < BENCH_MIX_BOOT_INFO + BENCH_MIX_WRITE_DATA + BENCH_MIX_READ_COMMAND + BENCH_MIX_COMMAND) type = REQ_COMMAND;
+
+            // The sequence shall change at every application frame
+            if(++seq == 0) seq = 1;
+            host_send(type, seq);
+            issued++;
+            idle_loops = 0;
+        }
+
+        // Bus activity until the start of the device loop
+        unsigned long answered = bench.answered;
+        bus_run();
+
+        // Device side: one main loop iteration
+        uint64_t t0 = now_ns();
+        MET_Can_Protocol_Loop();
+        cpu_ns += now_ns() - t0;
+        if(stream && MET_Can_Protocol_SendStream(stream_frame)) stream_frame[0]++;
+        loops++;
+
+        bus.now += (uint64_t) loop_us * 1000;
+
+        // Requests never answered are given up after a while
+        if((bench.answered == answered) && (!bus.busy)){
+            if(++idle_loops > BENCH_DRAIN_LOOPS){
+                bench.unanswered += bench.count;
+                bench.head = 0;
+                bench.count = 0;
+                idle_loops = 0;
+            }
+        }else idle_loops = 0;
+    }
+
+    double seconds = (double) bus.now / 1e9;
+
+    qsort(bench.latency, bench.n_latency, sizeof(uint64_t), compare_u64);
+
+    printf("MET CAN protocol benchmark (virtual CAN0, RX FIFO0 %u, TX FIFO %u, %u kbit/s, loop %u us)\n",
+            (unsigned) BENCH_RX_FIFO0_ELEMENTS, (unsigned) BENCH_TX_FIFO_ELEMENTS, bit_rate, loop_us);
+    printf("  requests      : %lu, window %u\n", requests, window);
+    for(int i=0; i<REQ_TYPES; i++) printf("    %-12s: %lu\n", request_names[i], bench.sent[i]);
+    printf("  answered      : %lu\n", bench.answered);
+    printf("  dropped       : %lu (rx overrun %lu)\n", bench.unanswered, bench.rx_overrun);
+    printf("  tx fifo full  : %lu transmissions refused\n", bench.tx_full);
+    if(stream) printf("  stream        : %lu frames\n", bench.stream_frames);
+    printf("  simulated     : %.3f s, bus load %.1f %%\n", seconds, 100.0 * (double) bus.busy_ns / (double) bus.now);
+    printf("  throughput    : %.0f frames/s, %.0f transactions/s\n", (double) bench.bus_frames / seconds, (double) bench.answered / seconds);
+    printf("  latency (us)  : p50 %.1f  p90 %.1f  p99 %.1f  p99.9 %.1f  max %.1f\n",
+            percentile(50) / 1e3, percentile(90) / 1e3, percentile(99) / 1e3, percentile(99.9) / 1e3,
+            (bench.n_latency ? bench.latency[bench.n_latency - 1] : 0) / 1e3);
+    printf("  device worst  : %u bit times (MET_Can_Protocol_GetMaxLatency)\n", MET_Can_Protocol_GetMaxLatency());
+    printf("  host CPU      : %.0f ns per MET_Can_Protocol_Loop() call\n", (double) cpu_ns / (double) loops);
+
+    free(bench.latency);
+    return EXIT_SUCCESS;
+}
+
+/** @}*/
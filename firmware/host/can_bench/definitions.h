@@ -0,0 +1,107 @@
+#ifndef _HOST_DEFINITIONS_H
+#define _HOST_DEFINITIONS_H
+
+/*!
+ * \defgroup hostCanBenchStub Host stand-in of the Harmony 3 definitions
+ * \ingroup hostCanBench
+ *
+ * This header shadows config/default/definitions.h when the MET CAN library
+ * is compiled on the host. It declares only the subset of the Harmony 3
+ * CAN0, NVMCTRL and CMSIS symbols the library actually uses.
+ *
+ * The CAN0 functions are implemented by the benchmark (can_bench.c) on top
+ * of an in-process virtual bus, the SmartEEPROM and the NVM user page
+ * are plain RAM arrays.
+ *
+ *  @{
+ */
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+#include <string.h>
+
+/// Size of the CAN0 message RAM, as generated by Harmony for the target
+#define CAN0_MESSAGE_RAM_CONFIG_SIZE     48U
+
+/*
+ * CAN0 message RAM sizes in bytes, as generated by Harmony for the target:
+ * 1 element of 16 bytes for the RX FIFO0 (CAN_RXF0C.F0S = 1)
+ * and for the TX FIFO (CAN_TXBC.TFQS = 1).
+ */
+#define CAN0_RX_FIFO0_ELEMENT_SIZE       16U
+#define CAN0_RX_FIFO0_SIZE               16U
+#define CAN0_TX_FIFO_BUFFER_ELEMENT_SIZE 16U
+#define CAN0_TX_FIFO_BUFFER_SIZE         16U
+
+#define CAN_PSR_LEC_Msk     0x7U //!< Last Error Code field of the CAN_PSR register
+#define CAN_ERROR_NONE      0x0U //!< No error
+#define CAN_ERROR_LEC_NC    0x7U //!< No change since the last read
+
+typedef uint32_t CAN_ERROR;
+
+typedef enum{
+    CAN_MODE_NORMAL = 0,
+    CAN_MODE_FD_WITHOUT_BRS,
+    CAN_MODE_FD_WITH_BRS
+}CAN_MODE;
+
+typedef enum{
+    CAN_MSG_ATTR_TX_FIFO_DATA_FRAME = 0,
+    CAN_MSG_ATTR_TX_FIFO_RTR_FRAME,
+    CAN_MSG_ATTR_TX_BUFFER_DATA_FRAME,
+    CAN_MSG_ATTR_TX_BUFFER_RTR_FRAME
+}CAN_MSG_TX_ATTRIBUTE;
+
+typedef enum{
+    CAN_MSG_ATTR_RX_BUFFER = 0,
+    CAN_MSG_ATTR_RX_FIFO0,
+    CAN_MSG_ATTR_RX_FIFO1
+}CAN_MSG_RX_ATTRIBUTE;
+
+typedef enum{
+    CAN_MSG_RX_DATA_FRAME = 0,
+    CAN_MSG_RX_REMOTE_FRAME
+}CAN_MSG_RX_FRAME_ATTRIBUTE;
+
+typedef void (*CAN_CALLBACK) (uintptr_t contextHandle);
+
+bool CAN0_MessageTransmit(uint32_t id, uint8_t length, uint8_t* data, CAN_MODE mode, CAN_MSG_TX_ATTRIBUTE msgAttr);
+bool CAN0_MessageReceive(uint32_t *id, uint8_t *length, uint8_t *data, uint16_t *timestamp, CAN_MSG_RX_ATTRIBUTE msgAttr, CAN_MSG_RX_FRAME_ATTRIBUTE *msgFrameAttr);
+CAN_ERROR CAN0_ErrorGet(void);
+bool CAN0_TxFIFOIsFull(void);
+void CAN0_MessageRAMConfigSet(uint8_t *msgRAMConfigBaseAddress);
+void CAN0_TxCallbackRegister(CAN_CALLBACK callback, uintptr_t contextHandle);
+void CAN0_RxCallbackRegister(CAN_CALLBACK callback, uintptr_t contextHandle, CAN_MSG_RX_ATTRIBUTE msgAttr);
+
+/// Replaces the CAN0 TSCV register read: host time in us (16 bit wrap)
+uint16_t CAN0_TimestampCounterGet(void);
+#define MET_CAN_TIMESTAMP()     CAN0_TimestampCounterGet()
+
+/// Replaces the CAN0 TXFQS.TFFL register field read
+uint32_t CAN0_TxFIFOFreeLevelGet(void);
+#define MET_CAN_TX_FIFO_FREE()  CAN0_TxFIFOFreeLevelGet()
+
+bool NVMCTRL_SmartEEPROM_IsBusy(void);
+bool NVMCTRL_SmartEEPROM_IsActiveSectorFull(void);
+void NVMCTRL_SmartEEPROMSectorReallocate(void);
+
+/// Replaces the NVMCTRL bulk read: the address is a host pointer
+#define NVMCTRL_Read(data, length, address)    ((void) memcpy((data), (address), (length)))
+
+/// Replaces the NVMCTRL INTFLAG.SEESFULL register flag clear
+#define MET_SEESFULL_CLEAR()    ((void) 0)
+
+void NVIC_SystemReset(void);
+
+extern uint8_t  host_seeprom[1024];     //!< SmartEEPROM virtual area
+extern uint8_t  host_user_page[16];     //!< NVM User Page (fuses)
+extern uint8_t  host_boot_ram[16];      //!< Bootloader shared RAM area
+
+#define SEEPROM_ADDR            (host_seeprom)
+#define USER_PAGE_ADDR          (host_user_page)
+#define _BOOTLOADER_SHARED_RAM  (host_boot_ram)
+
+/** @}*/
+
+#endif // _HOST_DEFINITIONS_H
@@ -0,0 +1,314 @@
+/*!
+ * \defgroup hostSizeReport Host per-module size report
+ * \ingroup libraryModules
+ *
+ * # Overview
+ *
+ * This host program reads the XC32 linker map of the FW325 application
+ * (dist/<conf>/production/FW325.X.production.map) and reports
+ * the program memory (ROM) and data memory (RAM) used by every module:
+ *
+ * |MODULE|OBJECT FILES|
+ * |:--|:--|
+ * |motors|Motors/motors.c|
+ * |protocol|Protocol/protocol.c|
+ * |MET library|Shared/CAN/MET_can_protocol.c|
+ * |plib|Harmony 3 generated files (config/default)|
+ * |runtime|XC32 libraries, crt files and linker generated sections (.dinit)|
+ * |<name>|any other application file (main, profiler, trace, ...)|
+ *
+ * Only the input sections allocated by the linker are counted
+ * (the sections removed by --gc-sections are listed before the memory map and are skipped):
+ * + .text, .rodata, .vectors, .hot_text, .dinit: ROM;
+ * + .data, .bss, COMMON: RAM (the initial values of .data are into the .dinit ROM template).
+ *
+ * With the link time optimization (release configuration) the code is
+ * attributed by the linker to the ltrans objects: the sections are then
+ * assigned to the module of the same section name (-ffunction-sections)
+ * found in a reference map built without LTO (option -r).
+ * The functions inlined by the optimizer are accounted to the caller module;
+ * the sections not found in the reference map are reported as "lto".
+ *
+ * When a second map is passed, the report shows the difference
+ * of every module against it (e.g. release against default).
+ *
+ * The execution time of the control loop is not measured by this tool:
+ * use the hot-path profiler (\ref PROFMOD) on the target.
+ *
+ * # Build and run
+ *
+ * From the firmware directory:
+ * ```text
+ * gcc -O1 -std=gnu99 -Wall host/size_report/size_report.c -o size_report
+ *
+ * ./size_report [-r reference.map] file.map [baseline.map]
+ * ```
+ *
+ *  @{
+ */
+
+#define _SIZE_REPORT_C
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <unistd.h>
+
+#define REPORT_MAX_MODULES      32      //!< Max number of reported modules
+#define REPORT_MAX_SECTIONS     2048    //!< Max number of sections of the reference map
+#define REPORT_LINE_SIZE        1024    //!< Max length of a map line
+#define REPORT_NAME_SIZE        128     //!< Max length of a section or module name
+
+/// Memory usage of a module
+typedef struct{
+    char name[REPORT_NAME_SIZE];
+    uint32_t rom;
+    uint32_t ram;
+}REPORT_MODULE_t;
+
+/// Memory usage of all the modules of a map
+typedef struct{
+    REPORT_MODULE_t module[REPORT_MAX_MODULES];
+    unsigned modules;
+}REPORT_MAP_t;
+
+/// Section name to module table (reference map)
+static struct{
+    char section[REPORT_MAX_SECTIONS][REPORT_NAME_SIZE];
+    char module[REPORT_MAX_SECTIONS][REPORT_NAME_SIZE];
+    unsigned count;
+}reference;
+
+static REPORT_MAP_t report;
+static REPORT_MAP_t baseline;
+
+/// Memory class of an input section
+typedef enum{
+    SECTION_SKIP = 0,   //!< Not allocated or debug section
+    SECTION_ROM,        //!< Program memory
+    SECTION_RAM,        //!< Data memory
+}REPORT_CLASS_t;
+
+static bool startsWith(const char* s, const char* prefix){
+    return strncmp(s, prefix, strlen(prefix)) == 0;
+}
+
+/// Returns the memory class of an input section
+static REPORT_CLASS_t sectionClass(const char* name){
+    if(startsWith(name, ".bss") || startsWith(name, ".data") || startsWith(name, "COMMON")) return SECTION_RAM;
+    if(startsWith(name, ".text") || startsWith(name, ".rodata") || startsWith(name, ".vectors") ||
+       startsWith(name, ".hot_text") || startsWith(name, ".dinit") || startsWith(name, ".init") ||
+       startsWith(name, ".fini") || startsWith(name, ".ARM.exidx")) return SECTION_ROM;
+    return SECTION_SKIP;
+}
+
+/// Returns the module name of an input file
+static void fileModule(const char* file, char* module){
+    const char* base = strrchr(file, '/');
+    base = (base) ? base + 1 : file;
+
+    if(strchr(file, '(') || startsWith(base, "crt") || (strcmp(file, "data_init") == 0) || (strcmp(file, "linker stubs") == 0)){
+        strcpy(module, "runtime");
+    }else if(strstr(base, "ltrans")){
+        strcpy(module, "lto");
+    }else if(strcmp(base, "motors.o") == 0){
+        strcpy(module, "motors");
+    }else if(strcmp(base, "protocol.o") == 0){
+        strcpy(module, "protocol");
+    }else if(strcmp(base, "MET_can_protocol.o") == 0){
+        strcpy(module, "MET library");
+    }else if(startsWith(base, "plib_") || (strcmp(base, "initialization.o") == 0) || (strcmp(base, "interrupts.o") == 0) ||
+             (strcmp(base, "exceptions.o") == 0) || (strcmp(base, "startup_xc32.o") == 0) ||
+             (strcmp(base, "libc_syscalls.o") == 0) || (strcmp(base, "xc32_monitor.o") == 0)){
+        strcpy(module, "plib");
+    }else{
+        snprintf(module, REPORT_NAME_SIZE, "%.*s", (int) strcspn(base, "."), base);
+    }
+}
+
+/// Adds the size of a section to a module of the map
+static void addSize(REPORT_MAP_t* map, const char* module, REPORT_CLASS_t cls, uint32_t size){
+    unsigned i;
+
+    for(i = 0; i < map->modules; i++){
+        if(strcmp(map->module[i].name, module) == 0) break;
+    }
+    if(i == map->modules){
+        if(map->modules == REPORT_MAX_MODULES) return;
+        snprintf(map->module[i].name, REPORT_NAME_SIZE, "%s", module);
+        map->modules++;
+    }
+
+    if(cls == SECTION_ROM) map->module[i].rom += size;
+    else map->module[i].ram += size;
+}
+
+/// Returns the module of a section name in the reference map (NULL if not found)
+static const char* referenceModule(const char* section){
+    for(unsigned i = 0; i < reference.count; i++){
+        if(strcmp(reference.section[i], section) == 0) return reference.module[i];
+    }
+    return NULL;
+}
+
+/**
+ * This function parses the memory map of a linker map file.
+ *
+ * The input sections are printed by the linker in one line:
+ * ` .text.name  0xADDRESS  0xSIZE file`
+ * or, with a long section name, in two lines:
+ * ` .text.long_name`
+ * `             0xADDRESS  0xSIZE file`
+ *
+ * @param path map file
+ * @param map report to be filled (NULL to fill the reference table)
+ * @return true if the memory map has been found
+ */
+static bool parseMap(const char* path, REPORT_MAP_t* map){
+    char line[REPORT_LINE_SIZE];
+    char section[REPORT_NAME_SIZE] = "";
+    bool memory_map = false;
+    FILE* fp = fopen(path, "r");
+
+    if(!fp){
+        perror(path);
+        return false;
+    }
+
+    while(fgets(line, sizeof(line), fp)){
+        unsigned long long address, size;
+        char name[REPORT_NAME_SIZE];
+        char module[REPORT_NAME_SIZE];
+        const char* rest;
+        int n = 0;
+
+        line[strcspn(line, "\r\n")] = 0;
+
+        if(!memory_map){
+            memory_map = startsWith(line, "Linker script and memory map");
+            continue;
+        }
+
+        // Input section name: one leading space (the output sections start at column 0)
+        if((line[0] == ' ') && (line[1] != ' ') && (line[1] != '*') && (line[1] != 0)){
+            if(sscanf(line, " %127s %n", name, &n) != 1) continue;
+            snprintf(section, sizeof(section), "%s", name);
+            rest = line + n;
+            if(*rest == 0) continue; // Long name: the size is on the next line
+        }else if(section[0] && startsWith(line, "                0x")){
+            rest = line;
+        }else{
+            section[0] = 0;
+            continue;
+        }
+
+        // Address, size and file (the symbol lines have no file)
+        if(sscanf(rest, " %llx %llx %n", &address, &size, &n) != 2) { section[0] = 0; continue; }
+        rest += n;
+        if((*rest == 0) || (size == 0) || (sectionClass(section) == SECTION_SKIP)) { section[0] = 0; continue; }
+
+        fileModule(rest, module);
+
+        if(!map){
+            if((reference.count < REPORT_MAX_SECTIONS) && strcmp(module, "runtime")){
+                snprintf(reference.section[reference.count], REPORT_NAME_SIZE, "%s", section);
+                snprintf(reference.module[reference.count], REPORT_NAME_SIZE, "%s", module);
+                reference.count++;
+            }
+        }else{
+            if(strcmp(module, "lto") == 0){
+                const char* ref = referenceModule(section);
+                if(ref) snprintf(module, sizeof(module), "%s", ref);
+            }
+            addSize(map, module, sectionClass(section), (uint32_t) size);
+        }
+        section[0] = 0;
+    }
+
+    fclose(fp);
+    if(!memory_map) fprintf(stderr, "%s: memory map not found\n", path);
+    return memory_map;
+}
+
+/// Returns the module of a map with a given name (NULL if not present)
+static const REPORT_MODULE_t* findModule(const REPORT_MAP_t* map, const char* name){
+    for(unsigned i = 0; i < map->modules; i++){
+        if(strcmp(map->module[i].name, name) == 0) return &map->module[i];
+    }
+    return NULL;
+}
+
+static int compareRom(const void* a, const void* b){
+    const REPORT_MODULE_t* ma = a;
+    const REPORT_MODULE_t* mb = b;
+    return (mb->rom > ma->rom) - (mb->rom < ma->rom);
+}
+
+/// Prints the report (with the difference against the baseline if present)
+static void printReport(bool with_baseline){
+    uint32_t rom = 0, ram = 0, base_rom = 0, base_ram = 0;
+
+    qsort(report.module, report.modules, sizeof(REPORT_MODULE_t), compareRom);
+
+    printf("%-16s %8s %8s", "module", "ROM", "RAM");
+    if(with_baseline) printf(" %9s %9s", "dROM", "dRAM");
+    printf("\n");
+
+    for(unsigned i = 0; i < report.modules; i++){
+        const REPORT_MODULE_t* m = &report.module[i];
+        printf("%-16s %8u %8u", m->name, m->rom, m->ram);
+        if(with_baseline){
+            const REPORT_MODULE_t* b = findModule(&baseline, m->name);
+            printf(" %+9d %+9d", (int) m->rom - (int) (b ? b->rom : 0), (int) m->ram - (int) (b ? b->ram : 0));
+        }
+        printf("\n");
+        rom += m->rom;
+        ram += m->ram;
+    }
+
+    // Modules present only into the baseline
+    if(with_baseline){
+        for(unsigned i = 0; i < baseline.modules; i++){
+            const REPORT_MODULE_t* b = &baseline.module[i];
+            if(!findModule(&report, b->name)) printf("%-16s %8u %8u %+9d %+9d\n", b->name, 0u, 0u, -(int) b->rom, -(int) b->ram);
+        }
+        for(unsigned i = 0; i < baseline.modules; i++){
+            base_rom += baseline.module[i].rom;
+            base_ram += baseline.module[i].ram;
+        }
+    }
+
+    printf("%-16s %8u %8u", "total", rom, ram);
+    if(with_baseline) printf(" %+9d %+9d", (int) rom - (int) base_rom, (int) ram - (int) base_ram);
+    printf("\n");
+}
+
+static void usage(const char* prog){
+    fprintf(stderr, "usage: %s [-r reference.map] file.map [baseline.map]\n", prog);
+}
+
+int main(int argc, char** argv){
+    int opt;
+
+    while((opt = getopt(argc, argv, "r:")) != -1){
+        switch(opt){
+            case 'r': if(!parseMap(optarg, NULL)) return EXIT_FAILURE; break;
+            default: usage(argv[0]); return EXIT_FAILURE;
+        }
+    }
+
+    if((optind >= argc) || (argc - optind > 2)){
+        usage(argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    if(!parseMap(argv[optind], &report)) return EXIT_FAILURE;
+    if((argc - optind == 2) && !parseMap(argv[optind + 1], &baseline)) return EXIT_FAILURE;
+
+    printReport(argc - optind == 2);
+    return EXIT_SUCCESS;
+}
+
+/** @}*/
@@ -0,0 +1,249 @@
+/*!
+ * \defgroup hostTraceDecode Event trace decoder (host tool)
+ *
+ * This tool rebuilds the device event timeline from a CAN log
+ * containing the frames streamed with the CMD_TRACE_STREAM command
+ * (see the Trace module of the firmware).
+ *
+ * ## Build
+ *
+ * From the firmware directory:
+ * ```text
+ * gcc -O1 -std=gnu99 -Wall -Isrc host/trace_decode/trace_decode.c -o trace_decode
+ * ```
+ *
+ * ## Usage
+ *
+ * ```text
+ * trace_decode [-d device_id] [-q] [logfile]
+ *
+ *  -d device_id : device CAN id (default 0x15): the stream frames are 0x180 + device_id
+ *  -q           : prints only the move summaries (no per-tick samples)
+ *  logfile      : candump log; the standard input if missing
+ * ```
+ *
+ * Both the candump formats are accepted:
+ * ```text
+ * (1697040000.123456) can0 195#0501020304050607
+ *   can0  195   [8]  05 01 02 03 04 05 06 07
+ * ```
+ *
+ * For every activation the tool prints the sequence of the events and a summary:
+ * duration, travel, power command range (% of the nominal 24V) and termination code (target, obstacle, timeout, ...).
+ *
+ *  @{
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "Trace/trace.h"
+
+#define STREAM_BASE_ADDRESS 0x180   //!< _CAN_ID_STREAM_BASE_ADDRESS of the MET CAN library
+#define TICKS_PER_SECOND    1024.0  //!< RTC counter frequency
+
+/// Command error codes (see MET_CommandErrors_t and PROTOCOL_APPLICATION_ERROR_t)
+static const char* error_name(uint8_t code){
+    switch(code){
+        case 0: return "target";
+        case 1: return "busy";
+        case 2: return "invalid-data";
+        case 3: return "not-enabled";
+        case 4: return "not-available";
+        case 5: return "wrong-return-code";
+        case 6: return "aborted";
+        case 7: return "obstacle";
+        case 8: return "timeout";
+        case 9: return "key-released";
+        case 10: return "key-pressed";
+        case 11: return "over-current";
+        case 12: return "power-switch";
+        default: return "error";
+    }
+}
+
+static const char* mode_names[] = {"DISABLE", "CALIB", "COMMAND", "SERVICE"};
+static const char* axis_names[] = {"-", "X", "Y", "Z"};
+static const char* driver_names[] = {"off", "X-left", "X-right", "X-short", "Y-home", "Y-field", "Y-short", "Z-up", "Z-down", "Z-short"};
+
+/// Current activation being rebuilt
+static struct{
+    bool active;
+    uint8_t axis;
+    int target;
+    double t_start;
+    double t_hold;
+    int pos_start;
+    int pos_last;
+    int pos_min;
+    int pos_max;
+    int power_min;
+    int power_max;
+    unsigned samples;
+}move;
+
+static unsigned long n_moves = 0;
+static unsigned long n_failed = 0;
+
+/// Time unwrapping of the 24 bit timestamp
+static double unwrap_time(uint32_t t24){
+    static bool first = true;
+    static uint32_t last = 0;
+    static uint64_t base = 0;
+
+    if(!first && (t24 < last) && (last - t24 > 0x800000)) base += 0x1000000;
+    first = false;
+    last = t24;
+    return (double) (base + t24) / TICKS_PER_SECOND;
+}
+
+static int16_t data16(const uint8_t* d){
+    return (int16_t) ((uint16_t) d[0] | ((uint16_t) d[1] << 8));
+}
+
+static void decode_record(const TRACE_RECORD_t* rec, bool quiet){
+    uint32_t t24 = (uint32_t) rec->t[0] | ((uint32_t) rec->t[1] << 8) | ((uint32_t) rec->t[2] << 16);
+    double t = (rec->type == TRACE_STREAM_END) ? 0 : unwrap_time(t24);
+    const uint8_t* d = rec->d;
+
+    switch(rec->type){
+        case TRACE_MODE_CHANGE:
+            printf("%10.3f  MODE      %s\n", t, (d[0] < 4) ? mode_names[d[0]] : "?");
+            break;
+
+        case TRACE_CMD_START:
+            memset(&move, 0, sizeof(move));
+            move.active = true;
+            move.axis = (d[0] < 4) ? d[0] : 0;
+            move.target = data16(&d[2]);
+            move.t_start = t;
+            move.power_min = 255;
+            printf("%10.3f  START     %s -> %d.%d mm (%s%s)\n", t, axis_names[move.axis], move.target / 10, abs(move.target % 10),
+                    (d[1] & 1) ? "protocol" : "local", (d[1] & 2) ? ", key" : "");
+            break;
+
+        case TRACE_SAMPLE:{
+            int pos = data16(&d[0]);
+            if(move.active){
+                if(!move.samples){
+                    move.pos_start = move.pos_min = move.pos_max = pos;
+                }
+                if(pos < move.pos_min) move.pos_min = pos;
+                if(pos > move.pos_max) move.pos_max = pos;
+                if(d[2] < move.power_min) move.power_min = d[2];
+                if(d[2] > move.power_max) move.power_max = d[2];
+                move.pos_last = pos;
+                move.samples++;
+            }
+            if(!quiet) printf("%10.3f  sample    pos %d.%d mm  power %u%%  driver %s\n", t, pos / 10, abs(pos % 10), d[2], (d[3] < 10) ? driver_names[d[3]] : "?");
+        }
+        break;
+
+        case TRACE_CMD_HOLD:
+            move.t_hold = t;
+            printf("%10.3f  HOLD      %s at %d.%d mm: %s\n", t, axis_names[(d[0] < 4) ? d[0] : 0], data16(&d[2]) / 10, abs(data16(&d[2]) % 10), error_name(d[1]));
+            break;
+
+        case TRACE_CMD_STOP:
+            printf("%10.3f  STOP      %s at %d.%d mm: %s\n", t, axis_names[(d[0] < 4) ? d[0] : 0], data16(&d[2]) / 10, abs(data16(&d[2]) % 10), error_name(d[1]));
+            if(move.active){
+                double t_motion = (move.t_hold > 0 ? move.t_hold : t) - move.t_start;
+                n_moves++;
+                if(d[1]) n_failed++;
+                printf("            => move %s: %s, motion %.3f s, travel %d -> %d (range %d..%d), target %d, power %d..%d%%, %u samples\n",
+                        axis_names[move.axis], error_name(d[1]), t_motion, move.pos_start, move.pos_last,
+                        move.pos_min, move.pos_max, move.target, (move.samples) ? move.power_min : 0, move.power_max, move.samples);
+                move.active = false;
+            }
+            break;
+
+        case TRACE_BUZZER:
+            if(!quiet) printf("%10.3f  buzzer    %u pulses (%u/%u)%s\n", t, d[0], d[1], d[2], (d[3]) ? " alarm" : "");
+            break;
+
+        case TRACE_CAN_ERROR:
+            printf("%10.3f  CAN-ERROR code %u\n", t, d[0]);
+            break;
+
+        case TRACE_SUPPLY_SAG:
+            printf("%10.3f  SUPPLY-SAG min %u.%u V at %u%% power for %.0f ms\n", t, d[0] / 10, d[0] % 10, d[1], (uint16_t) data16(&d[2]) * 7.8);
+            break;
+
+        case TRACE_SAFETY_EDGE:
+            printf("%10.3f  SAFETY    %s feedback %s after %.1f ms%s\n", t, (d[0]) ? "needle" : "motor", (d[1]) ? "high" : "low",
+                    (uint16_t) data16(&d[2]) / 10.0, ((uint16_t) data16(&d[2]) == 0xFFFF) ? " or more" : "");
+            break;
+
+        case TRACE_STREAM_END:
+            printf("            -- end of stream: %u records, %u lost --\n", (unsigned) (uint16_t) data16(&d[0]), (unsigned) (uint16_t) data16(&d[2]));
+            break;
+
+        default:
+            printf("%10.3f  unknown record type %u\n", t, rec->type);
+    }
+}
+
+/// Parses a candump line: returns true if a 8 byte frame has been decoded
+static bool parse_line(const char* line, uint32_t* id, uint8_t* data){
+    const char* p = strchr(line, '#');
+    unsigned v[8];
+
+    if(p){
+        // candump -L format: ... ID#DATA
+        const char* q = p;
+        while((q > line) && (q[-1] != ' ')) q--;
+        *id = (uint32_t) strtoul(q, NULL, 16);
+        p++;
+        for(int i=0; i<8; i++){
+            if(sscanf(p + 2*i, "%2x", &v[i]) != 1) return false;
+            data[i] = (uint8_t) v[i];
+        }
+        return true;
+    }
+
+    // candump default format: iface ID [8] D0 .. D7
+    char iface[32];
+    unsigned len;
+    if(sscanf(line, "%31s %x [%u] %x %x %x %x %x %x %x %x", iface, id, &len, &v[0], &v[1], &v[2], &v[3], &v[4], &v[5], &v[6], &v[7]) != 11) return false;
+    if(len != 8) return false;
+    for(int i=0; i<8; i++) data[i] = (uint8_t) v[i];
+    return true;
+}
+
+int main(int argc, char** argv){
+    uint32_t device_id = 0x15;
+    bool quiet = false;
+    FILE* in = stdin;
+
+    for(int i=1; i<argc; i++){
+        if(!strcmp(argv[i], "-d") && (i+1 < argc)) device_id = (uint32_t) strtoul(argv[++i], NULL, 0);
+        else if(!strcmp(argv[i], "-q")) quiet = true;
+        else if(argv[i][0] == '-'){
+            fprintf(stderr, "usage: %s [-d device_id] [-q] [logfile]\n", argv[0]);
+            return EXIT_FAILURE;
+        }else if(!(in = fopen(argv[i], "r"))){
+            perror(argv[i]);
+            return EXIT_FAILURE;
+        }
+    }
+
+    char line[256];
+    unsigned long records = 0;
+    while(fgets(line, sizeof(line), in)){
+        uint32_t id;
+        TRACE_RECORD_t rec;
+        if(!parse_line(line, &id, (uint8_t*) &rec)) continue;
+        if(id != STREAM_BASE_ADDRESS + device_id) continue;
+        decode_record(&rec, quiet);
+        records++;
+    }
+
+    printf("\n%lu records, %lu moves, %lu failed\n", records, n_moves, n_failed);
+    if(in != stdin) fclose(in);
+    return EXIT_SUCCESS;
+}
+
+/** @}*/
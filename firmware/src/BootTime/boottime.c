@@ -0,0 +1,129 @@
+#define _BOOTTIME_C
+
+#include "application.h"
+#include "boottime.h"
+#include "Protocol/protocol.h"
+
+/**
+ * \addtogroup BOOTTIMEMOD
+ *
+ *  @{
+ */
+
+/// Boot time measurement data
+static struct{
+    uint32_t cycles;                //!< Cycle counter at the last update
+    uint32_t us;                    //!< Time from the reset at the last update (us)
+    bool pll;                       //!< The CPU runs with the FDPLL0 clock
+    uint32_t time[BOOT_PHASES];     //!< Time of the boot phases (us)
+}bootTime;
+
+/// Publishes the boot times in the BOOT TIME STATUS registers
+static void bootTimePublish(void);
+
+/**
+ * This function is the XC32 reset hook, called by the Reset_Handler
+ * before the C runtime initialization: the cycle counter is cleared
+ * and started, so it measures the time from the reset vector.
+ *
+ * \note The function shall not access to the RAM variables
+ * (they are initialized after the call).
+ */
+void _on_reset(void){
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CYCCNT = 0;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+}
+
+/**
+ * This function accumulates the time elapsed from the last update.
+ *
+ * The cycles are converted with the CPU clock of the current phase;
+ * the remainder (less than 1us) is kept for the next update.
+ */
+static void bootTimeAccumulate(void){
+    uint32_t mhz = (bootTime.pll) ? CPU_CLOCK_FREQUENCY / 1000000 : BOOT_RESET_CLOCK_MHZ;
+    uint32_t us = (DWT->CYCCNT - bootTime.cycles) / mhz;
+
+    bootTime.us += us;
+    bootTime.cycles += us * mhz;
+}
+
+/**
+ * This function marks the end of a boot phase.
+ *
+ * Only the first mark of a phase is recorded.
+ *
+ * @param phase boot phase
+ */
+void bootTimeMark(BOOT_PHASE_t phase){
+    if((phase >= BOOT_PHASES) || (bootTime.time[phase])) return;
+
+    bootTimeAccumulate();
+    bootTime.time[phase] = (bootTime.us) ? bootTime.us : 1;
+    if(phase == BOOT_PHASE_CLOCK) bootTime.pll = true;
+
+    bootTimePublish();
+}
+
+/**
+ * This function accumulates the elapsed time until the first answer.
+ *
+ * It shall be called at least every 35s (cycle counter wrap period):
+ * it is called every 1024ms by the main loop.
+ */
+void bootTimeUpdate(void){
+    if(!bootTime.time[BOOT_PHASE_ANSWER]) bootTimeAccumulate();
+}
+
+/**
+ * This function returns the time of a boot phase.
+ *
+ * @param phase boot phase
+ * @return the time from the reset in us or 0 if the phase is not yet completed
+ */
+uint32_t bootTimeGet(BOOT_PHASE_t phase){
+    if(phase >= BOOT_PHASES) return 0;
+    return bootTime.time[phase];
+}
+
+/// Converts a boot time into the register units (10us, saturated)
+static uint16_t bootTimeToReg(BOOT_PHASE_t phase){
+    uint32_t val = (bootTime.time[phase] + 5) / 10;
+    return (val > 0xFFFF) ? 0xFFFF : (uint16_t) val;
+}
+
+/**
+ * This function publishes the boot times in the BOOT TIME STATUS registers.
+ *
+ * The registers are not available before the protocol initialization:
+ * the times marked before are published with the following marks.
+ */
+static void bootTimePublish(void){
+    uint16_t val;
+
+    val = bootTimeToReg(BOOT_PHASE_CLOCK);
+    StatusBootTime0Register.T0L = (unsigned char) (val & 0xFF);
+    StatusBootTime0Register.T0H = (unsigned char) (val >> 8);
+    val = bootTimeToReg(BOOT_PHASE_SYSTEM);
+    StatusBootTime0Register.T1L = (unsigned char) (val & 0xFF);
+    StatusBootTime0Register.T1H = (unsigned char) (val >> 8);
+
+    val = bootTimeToReg(BOOT_PHASE_PROTOCOL);
+    StatusBootTime1Register.T0L = (unsigned char) (val & 0xFF);
+    StatusBootTime1Register.T0H = (unsigned char) (val >> 8);
+    val = bootTimeToReg(BOOT_PHASE_LOOP);
+    StatusBootTime1Register.T1L = (unsigned char) (val & 0xFF);
+    StatusBootTime1Register.T1H = (unsigned char) (val >> 8);
+
+    val = bootTimeToReg(BOOT_PHASE_ANSWER);
+    StatusBootAnswerRegister.TL = (unsigned char) (val & 0xFF);
+    StatusBootAnswerRegister.TH = (unsigned char) (val >> 8);
+    StatusBootAnswerRegister.RCAUSE = RSTC_REGS->RSTC_RCAUSE;
+
+    updateStatusRegister((void*) &StatusBootTime0Register);
+    updateStatusRegister((void*) &StatusBootTime1Register);
+    updateStatusRegister((void*) &StatusBootAnswerRegister);
+}
+
+/** @}*/
@@ -0,0 +1,97 @@
+#ifndef _BOOTTIME_H
+#define _BOOTTIME_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#ifdef __XC32
+#include "definitions.h"
+#endif
+
+#undef ext
+#undef ext_static
+
+#ifdef _BOOTTIME_C
+    #define ext
+    #define ext_static static
+#else
+    #define ext extern
+    #define ext_static extern
+#endif
+
+/*!
+ * \defgroup BOOTTIMEMOD Boot Time Module
+ * \ingroup applicationModule
+ *
+ * This module measures the time elapsed from the reset
+ * to the first answer of the device to the remote host.
+ *
+ * ## Module Function Description
+ *
+ * The time is measured with the Cortex-M4 DWT cycle counter,
+ * cleared and started by the _on_reset() hook at the reset vector
+ * (before the C runtime initialization).
+ * The time spent before the application reset vector
+ * (power-on reset, bootloader) is not measured.
+ *
+ * The boot sequence is divided in the following phases (see \ref BOOT_PHASE_t):
+ *
+ * |PHASE|END OF PHASE|
+ * |:--|:--|
+ * |\ref BOOT_PHASE_CLOCK|CPU clock switched to the FDPLL0 (120MHz)|
+ * |\ref BOOT_PHASE_SYSTEM|SYS_Initialize() completed|
+ * |\ref BOOT_PHASE_PROTOCOL|CAN protocol initialized (PARAMETER registers loaded, reception active)|
+ * |\ref BOOT_PHASE_LOOP|Main loop started: the received frames are answered|
+ * |\ref BOOT_PHASE_ANSWER|First answer sent to the remote host (RESET code)|
+ *
+ * The cycles of every phase are converted with the CPU clock active in the phase:
+ * \ref BOOT_RESET_CLOCK_MHZ (DFLL48M) until \ref BOOT_PHASE_CLOCK,
+ * CPU_CLOCK_FREQUENCY after.
+ *
+ * The cycle counter wraps every 35.8s at 120MHz:
+ * bootTimeUpdate() shall be called periodically (less than 35s)
+ * until the first answer, so the time is accumulated without overflow.
+ *
+ * The times are published in the BOOT TIME STATUS registers
+ * (see the \ref CANPROT module).
+ *
+ * ## Boot Critical Path
+ *
+ * The boot sequence is arranged in order to overlap the waiting times:
+ * + the FDPLL0 lock time overlaps the peripheral clock channels setup (CLOCK_Initialize());
+ * + the RTC enable synchronization (1.024kHz clock domain) overlaps
+ * the protocol and application initialization.
+ *
+ * ## Module API
+ *
+ * + bootTimeMark(): marks the end of a boot phase;
+ * + bootTimeUpdate(): accumulates the elapsed time (periodic call);
+ * + bootTimeGet(): returns the time of a boot phase;
+ *
+ *  @{
+ */
+
+/// Boot phases
+typedef enum{
+    BOOT_PHASE_CLOCK = 0,   //!< Clock system ready
+    BOOT_PHASE_SYSTEM,      //!< SYS_Initialize() completed
+    BOOT_PHASE_PROTOCOL,    //!< CAN protocol initialized
+    BOOT_PHASE_LOOP,        //!< Main loop started
+    BOOT_PHASE_ANSWER,      //!< First answer sent to the remote host
+    BOOT_PHASES             //!< Number of boot phases
+}BOOT_PHASE_t;
+
+#define BOOT_RESET_CLOCK_MHZ    48  //!< CPU clock at the reset (DFLL48M) in MHz
+
+/// Marks the end of a boot phase
+ext void bootTimeMark(BOOT_PHASE_t phase);
+
+/// Accumulates the elapsed time until the first answer (periodic call)
+ext void bootTimeUpdate(void);
+
+/// Returns the time of a boot phase from the reset (us, 0 if not yet reached)
+ext uint32_t bootTimeGet(BOOT_PHASE_t phase);
+
+/** @}*/
+
+#endif // _BOOTTIME_H
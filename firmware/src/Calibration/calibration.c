@@ -0,0 +1,296 @@
+#define _CALIBRATION_C
+
+#include "application.h"
+#include "calibration.h"
+#include "Protocol/protocol.h"
+#include "Shared/CAN/MET_can_protocol.h"
+
+/**
+ * \addtogroup CALIBMOD
+ *
+ *  @{
+ */
+
+/// Default gains of the axes
+static const int calibDefaultGain[CALIB_AXES] = {CALIB_DEFAULT_X_GAIN, CALIB_DEFAULT_Y_GAIN, CALIB_DEFAULT_Z_GAIN};
+
+/// Default max positions of the axes
+static const int calibDefaultMax[CALIB_AXES] = {CALIB_DEFAULT_X_MAX_dm, CALIB_DEFAULT_Y_MAX_dm, CALIB_DEFAULT_Z_MAX_dm};
+
+/// Default activation timeouts of the axes
+static const int calibDefaultTimeout[CALIB_AXES] = {CALIB_DEFAULT_X_TIMEOUT, CALIB_DEFAULT_Y_TIMEOUT, CALIB_DEFAULT_Z_TIMEOUT};
+
+/// Default power level thresholds (mm)
+static const uint8_t calibDefaultPower[CALIB_POWER_LEVELS + 1] = {CALIB_DEFAULT_POWER_TABLE_0, CALIB_DEFAULT_POWER_TABLE_1};
+
+/// First LUT PARAMETER register of the axes
+static const uint8_t calibLutIdx[CALIB_AXES] = {PARAM_X_LUT_IDX, PARAM_Y_LUT_IDX, PARAM_Z_LUT_IDX};
+
+/// Calibration sweep data
+static struct{
+    int axis;                           //!< Axis in calibration (-1 = no sweep)
+    int points;                         //!< Number of collected points
+    int u[CALIB_SWEEP_MAX_POINTS];      //!< ADC values (offset removed, ascending)
+    int pos[CALIB_SWEEP_MAX_POINTS];    //!< Reference positions (0.1mm)
+}calibSweep = {.axis = -1};
+
+/// Returns the 16 bit little endian content of a PARAMETER register
+static uint16_t calibGetParam16(uint8_t idx, uint8_t data_index){
+    return (uint16_t) MET_Can_Protocol_GetParameter(idx, data_index) | ((uint16_t) MET_Can_Protocol_GetParameter(idx, data_index + 1) << 8);
+}
+
+/// Returns the value if it is in the valid range, the default value otherwise
+static int calibRange(int val, int min, int max, int def){
+    return ((val < min) || (val > max)) ? def : val;
+}
+
+/// Sets the 16 bit little endian content of a PARAMETER register
+static void calibSetParam16(uint8_t idx, uint8_t data_index, uint16_t val){
+    MET_Can_Protocol_SetParameterReg(idx, data_index, (uint8_t) val);
+    MET_Can_Protocol_SetParameterReg(idx, data_index + 1, (uint8_t) (val >> 8));
+}
+
+/**
+ * This function builds the linearization table of an axis.
+ *
+ * The breakpoints stored in the LUT PARAMETER registers are used 
+ * if they are monotonic (the last greater than the first): 
+ * because the segment width is a power of 2, the slope is a shift of the
+ * position difference.
+ *
+ * Otherwise the table is filled with the linear conversion of the axis.
+ *
+ * @param ax axis
+ */
+static void calibBuildLut(CALIB_AXIS_t ax){
+    CALIB_AXIS_DATA_t* data = &calibStruct.axis[ax];
+    int16_t p[CALIB_LUT_POINTS];
+
+    bool valid = true;
+    for(int i=0; i < CALIB_LUT_POINTS; i++){
+        p[i] = (int16_t) calibGetParam16(calibLutIdx[ax] + i / 2, (i % 2) * 2);
+        if((i) && (p[i] < p[i-1])) valid = false;
+    }
+    if(p[CALIB_LUT_POINTS - 1] <= p[0]) valid = false;
+
+    data->lut_valid = valid;
+    for(int i=0; i < CALIB_LUT_SEGMENTS; i++){
+        if(valid){
+            data->lut[i].base = (int64_t) p[i] << 16;
+            data->lut[i].slope = (int32_t) (p[i+1] - p[i]) << (16 - CALIB_LUT_SHIFT);
+        }else{
+            data->lut[i].base = (int64_t) (i << CALIB_LUT_SHIFT) * data->k_dm;
+            data->lut[i].slope = data->k_dm;
+        }
+    }
+}
+
+/**
+ * This function initializes the module.
+ *
+ * The function shall be called after ApplicationProtocolInit(),
+ * that loads the PARAMETER registers from the SmartEEPROM:
+ * + the calibration coefficients are calculated;
+ * + the module is registered to the CAN library in order
+ * to reload the coefficients every time the parameters are stored.
+ */
+void calibrationInit(void){
+    calibrationLoad();
+    MET_Can_Protocol_SetParamHandler(calibrationLoad);
+}
+
+/**
+ * This function converts the PARAMETER registers
+ * into the calibration coefficients used by the application.
+ *
+ * The parameters out of range are replaced with the default values:
+ * + offset out of \ref CALIB_OFFSET_MIN - \ref CALIB_OFFSET_MAX or
+ * gain out of \ref CALIB_GAIN_MIN - \ref CALIB_GAIN_MAX (offset and gain of the axis are both replaced);
+ * + max position out of 1 - \ref CALIB_MAX_dm_MAX, timeout out of 1 - \ref CALIB_TIMEOUT_MAX;
+ * + obstacle timing out of 1 - \ref CALIB_BYTE_MAX;
+ * + power thresholds out of 1 - \ref CALIB_BYTE_MAX or not strictly ascending;
+ * + key step setting out of 1 - \ref CALIB_BYTE_MAX (single step out of 2 - \ref CALIB_BYTE_MAX:
+ * less than 0.2mm is within the target band);
+ * + LUT breakpoints not monotonic (linear conversion);
+ *
+ * So a register never stored (0) or erased (0xFF) selects the default value.
+ *
+ * The Q16 coefficients are rounded up, so the truncated conversions
+ * give the exact integer results of the default gains.
+ * This is the only place where a division is used.
+ */
+void calibrationLoad(void){
+
+    for(int i=0; i < CALIB_AXES; i++){
+        CALIB_AXIS_DATA_t* ax = &calibStruct.axis[i];
+
+        ax->offset = (int16_t) calibGetParam16(PARAM_X_CALIB_IDX + i, 0);
+
+        int32_t gain = calibGetParam16(PARAM_X_CALIB_IDX + i, 2);
+        if((gain < CALIB_GAIN_MIN) || (gain > CALIB_GAIN_MAX) || (ax->offset < CALIB_OFFSET_MIN) || (ax->offset > CALIB_OFFSET_MAX)){
+            gain = calibDefaultGain[i];
+            ax->offset = CALIB_DEFAULT_OFFSET;
+        }
+        ax->k_dm = ((1000 << 16) + gain - 1) / gain;
+        ax->k_units = (int32_t) ((((int64_t) gain << 16) + 999) / 1000);
+
+        ax->max_dm = calibRange(calibGetParam16(PARAM_X_LIMITS_IDX + i, 0), 1, CALIB_MAX_dm_MAX, calibDefaultMax[i]);
+        ax->timeout = calibRange(calibGetParam16(PARAM_X_LIMITS_IDX + i, 2), 1, CALIB_TIMEOUT_MAX, calibDefaultTimeout[i]);
+
+        calibBuildLut((CALIB_AXIS_t) i);
+    }
+
+    calibStruct.obstacle_blank = calibRange(MET_Can_Protocol_GetParameter(PARAM_OBSTACLE_IDX, 0), 1, CALIB_BYTE_MAX, CALIB_DEFAULT_OBSTACLE_BLANK);
+    calibStruct.obstacle_delay = calibRange(MET_Can_Protocol_GetParameter(PARAM_OBSTACLE_IDX, 1), 1, CALIB_BYTE_MAX, CALIB_DEFAULT_OBSTACLE_DELAY);
+    calibStruct.obstacle_delta = calibRange(MET_Can_Protocol_GetParameter(PARAM_OBSTACLE_IDX, 2), 1, CALIB_BYTE_MAX, CALIB_DEFAULT_OBSTACLE_DELTA);
+
+    bool valid = true;
+    for(int i=0; i < CALIB_POWER_LEVELS; i++){
+        calibStruct.power_threshold[i] = 10 * MET_Can_Protocol_GetParameter(PARAM_POWER_TABLE_0_IDX + i / 4, i % 4);
+        if((calibStruct.power_threshold[i] == 0) || (calibStruct.power_threshold[i] > 10 * CALIB_BYTE_MAX) ||
+           ((i) && (calibStruct.power_threshold[i] <= calibStruct.power_threshold[i-1]))) valid = false;
+    }
+    if(!valid){
+        for(int i=0; i < CALIB_POWER_LEVELS; i++) calibStruct.power_threshold[i] = 10 * calibDefaultPower[i];
+    }
+
+    calibStruct.keystep_step = calibRange(MET_Can_Protocol_GetParameter(PARAM_KEYSTEP_IDX, 0), 2, CALIB_BYTE_MAX, CALIB_DEFAULT_KEYSTEP_STEP);
+    calibStruct.keystep_delay = calibRange(MET_Can_Protocol_GetParameter(PARAM_KEYSTEP_IDX, 1), 1, CALIB_BYTE_MAX, CALIB_DEFAULT_KEYSTEP_DELAY);
+    calibStruct.keystep_stage = calibRange(MET_Can_Protocol_GetParameter(PARAM_KEYSTEP_IDX, 2), 1, CALIB_BYTE_MAX, CALIB_DEFAULT_KEYSTEP_STAGE);
+    calibStruct.keystep_max = 10 * calibRange(MET_Can_Protocol_GetParameter(PARAM_KEYSTEP_IDX, 3), 1, CALIB_BYTE_MAX, CALIB_DEFAULT_KEYSTEP_MAX);
+}
+
+/**
+ * This function starts a calibration sweep on an axis.
+ *
+ * The points of a previous sweep are discarded.
+ *
+ * @param ax axis to be calibrated
+ */
+void calibrationSweepStart(CALIB_AXIS_t ax){
+    calibSweep.axis = (ax < CALIB_AXES) ? (int) ax : -1;
+    calibSweep.points = 0;
+}
+
+/**
+ * This function returns the axis of the pending calibration sweep.
+ *
+ * @return the axis or -1 if no sweep is pending
+ */
+int calibrationSweepAxis(void){
+    return calibSweep.axis;
+}
+
+/**
+ * This function adds a point to the pending calibration sweep.
+ *
+ * The points are kept sorted by ADC value, so the axis can be moved
+ * in any direction during the sweep: 
+ * a point with an ADC value already present replaces the previous one.
+ *
+ * @param u ADC value with the offset removed
+ * @param pos_dm reference position measured externally (0.1mm)
+ * @return the number of collected points or -1 if no sweep is pending or the point table is full
+ */
+int calibrationSweepPoint(int u, int pos_dm){
+    if(calibSweep.axis < 0) return -1;
+
+    int i = 0;
+    while((i < calibSweep.points) && (calibSweep.u[i] < u)) i++;
+
+    if((i == calibSweep.points) || (calibSweep.u[i] != u)){
+        if(calibSweep.points >= CALIB_SWEEP_MAX_POINTS) return -1;
+        for(int j = calibSweep.points; j > i; j--){
+            calibSweep.u[j] = calibSweep.u[j-1];
+            calibSweep.pos[j] = calibSweep.pos[j-1];
+        }
+        calibSweep.points++;
+    }
+
+    calibSweep.u[i] = u;
+    calibSweep.pos[i] = pos_dm;
+    return calibSweep.points;
+}
+
+/**
+ * This function completes the pending calibration sweep.
+ *
+ * The collected points shall be at least 2 and the position 
+ * shall increase with the ADC value.
+ *
+ * The position of every breakpoint is interpolated between the two
+ * nearest collected points (the first and last segments are extrapolated).
+ * The breakpoints are written into the LUT PARAMETER registers of the axis 
+ * and the table becomes immediatelly operative: 
+ * it shall be made persistent with the STORE_PARAMS frame.
+ *
+ * @return true if the LUT has been built
+ */
+bool calibrationSweepEnd(void){
+    int ax = calibSweep.axis;
+    int n = calibSweep.points;
+    calibSweep.axis = -1;
+
+    if((ax < 0) || (n < 2)) return false;
+    for(int i=1; i < n; i++){
+        if(calibSweep.pos[i] <= calibSweep.pos[i-1]) return false;
+    }
+
+    int k = 0;
+    for(int i=0; i < CALIB_LUT_POINTS; i++){
+        int u = i << CALIB_LUT_SHIFT;
+        while((k < n - 2) && (u >= calibSweep.u[k+1])) k++;
+
+        int du = calibSweep.u[k+1] - calibSweep.u[k];
+        int num = (u - calibSweep.u[k]) * (calibSweep.pos[k+1] - calibSweep.pos[k]);
+        int p = calibSweep.pos[k] + ((num >= 0) ? (num + du / 2) / du : (num - du / 2) / du);
+
+        if(p > INT16_MAX) p = INT16_MAX;
+        else if(p < INT16_MIN) p = INT16_MIN;
+        calibSetParam16(calibLutIdx[ax] + i / 2, (i % 2) * 2, (uint16_t) p);
+    }
+
+    calibBuildLut((CALIB_AXIS_t) ax);
+    return calibStruct.axis[ax].lut_valid;
+}
+
+/**
+ * This function clears the LUT PARAMETER registers of an axis:
+ * the axis returns to the linear conversion.
+ *
+ * @param ax axis
+ */
+void calibrationLutClear(CALIB_AXIS_t ax){
+    if(ax >= CALIB_AXES) return;
+    for(int i=0; i < CALIB_LUT_REGISTERS; i++){
+        calibSetParam16(calibLutIdx[ax] + i, 0, 0);
+        calibSetParam16(calibLutIdx[ax] + i, 2, 0);
+    }
+    calibBuildLut(ax);
+}
+
+/**
+ * This function converts an absolute position into ADC units (offset removed),
+ * inverting the linearization table.
+ *
+ * @param ax axis
+ * @param pos position (0.1mm)
+ * @return the ADC value with the offset removed or -1 if the position is out of the table
+ */
+int calibUnits(CALIB_AXIS_t ax, int pos){
+    if(ax >= CALIB_AXES) return -1;
+
+    for(int i = 0; i < CALIB_LUT_SEGMENTS; i++){
+        const CALIB_SEGMENT_t* seg = &calibStruct.axis[ax].lut[i];
+        if(seg->slope == 0) continue;
+
+        int64_t p = (int64_t) pos << 16;
+        int64_t end = seg->base + (int64_t) CALIB_LUT_WIDTH * seg->slope;
+        if(((p >= seg->base) && (p <= end)) || ((p <= seg->base) && (p >= end))){
+            return (i << CALIB_LUT_SHIFT) + (int) ((p - seg->base) / seg->slope);
+        }
+    }
+    return -1;
+}
+
+/** @}*/
@@ -0,0 +1,242 @@
+#ifndef _CALIBRATION_H
+#define _CALIBRATION_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#ifdef __XC32
+#include "definitions.h"
+#endif
+
+#undef ext
+#undef ext_static
+
+#ifdef _CALIBRATION_C
+    #define ext
+    #define ext_static static
+#else
+    #define ext extern
+    #define ext_static extern
+#endif
+
+/*!
+ * \defgroup CALIBMOD Calibration Parameters Module
+ * \ingroup applicationModule
+ *
+ * This module handles the calibration parameters of the device.
+ *
+ * ## Module Function Description
+ *
+ * The calibration parameters are stored into the PARAMETER registers
+ * of the CAN protocol (see the PARAMETER register description of the \ref CANPROT module):
+ * + the MET CAN library loads the registers from the SmartEEPROM at the startup;
+ * + the remote device changes the registers with the WRITE_PARAM frame;
+ * + the remote device makes the registers persistent with the STORE_PARAMS frame.
+ *
+ * The registers are never read in the control loop: calibrationLoad()
+ * converts them once into the \ref calibStruct RAM structure,
+ * at the startup and every time the registers are stored.
+ *
+ * The sensor gains are converted into fixed point Q16 coefficients,
+ * so the unit conversions of the position sensors require
+ * only a multiplication and a shift (no division in the hot path):
+ *
+ * + 0.1mm position = ((ADC - offset) * k_dm) >> 16, with k_dm = 65536 * 1000 / gain;
+ * + ADC units = (0.1mm position * k_units) >> 16, with k_units = 65536 * gain / 1000;
+ *
+ * where gain is the number of ADC units for a 100mm stroke.
+ * The coefficients are rounded up and the results are truncated toward zero,
+ * as the integer divisions of the previous unit macros:
+ * with the default gains the conversions give the same values.
+ *
+ * Every parameter out of its valid range (see \ref CALIB_GAIN_MIN and the following limits)
+ * is replaced with its default value, so the device is always operative
+ * also with an uninitialized or erased (0xFF) SmartEEPROM.
+ *
+ * ## Position Linearization
+ *
+ * The absolute position of an axis is calculated with a piecewise linear 
+ * table of \ref CALIB_LUT_SEGMENTS segments, each \ref CALIB_LUT_WIDTH ADC units wide
+ * (offset removed), so the segment index is the ADC value shifted right (O(1), no search)
+ * and every segment has its precomputed base position and Q16 slope:
+ *
+ * + i = (ADC - offset) >> \ref CALIB_LUT_SHIFT (saturated to the first and last segment);
+ * + 0.1mm position = (base[i] + ((ADC - offset) - i * \ref CALIB_LUT_WIDTH) * slope[i]) >> 16 (truncated toward zero);
+ *
+ * The table is built by calibrationLoad():
+ * + from the \ref CALIB_LUT_POINTS breakpoint positions of the axis LUT PARAMETER registers,
+ * if they have been set by a calibration sweep;
+ * + from the offset and gain of the axis otherwise (linear conversion).
+ *
+ * The conversion cost is the same in both cases.
+ *
+ * The calibration sweep collects up to \ref CALIB_SWEEP_MAX_POINTS pairs of
+ * (ADC value, reference position) while the axis is moved along the stroke,
+ * then it interpolates the pairs at the breakpoints:
+ * + calibrationSweepStart(): starts a sweep on an axis;
+ * + calibrationSweepPoint(): adds a pair (the reference position is measured externally);
+ * + calibrationSweepEnd(): builds the breakpoints into the LUT PARAMETER registers;
+ * + calibrationLutClear(): returns an axis to the linear conversion;
+ *
+ * The LUT is referred to the offset active during the sweep:
+ * the offset shall not be changed after a sweep.
+ *
+ * ## Module API
+ *
+ * + calibrationInit(): module initialization (after the protocol initialization);
+ * + calibrationLoad(): converts the PARAMETER registers into the RAM coefficients;
+ * + CALIB_TO_DM(ax, u): converts ADC units (offset removed) into 0.1mm units;
+ * + CALIB_TO_UNITS(ax, dm): converts 0.1mm units into ADC units;
+ * + calibPosition(): converts ADC units (offset removed) into the linearized absolute position;
+ * + calibUnits(): converts an absolute position into ADC units (offset removed), inverse of calibPosition();
+ *
+ *  @{
+ */
+
+/// Calibrated axes
+typedef enum{
+    CALIB_AXIS_X = 0,   //!< X axis
+    CALIB_AXIS_Y,       //!< Y axis
+    CALIB_AXIS_Z,       //!< Z axis
+    CALIB_AXES          //!< Number of calibrated axes
+}CALIB_AXIS_t;
+
+#define CALIB_POWER_LEVELS  7   //!< Number of power level thresholds (level 1 to 7)
+
+/**
+ * \name Default calibration values
+ *
+ * The default values reproduce the hardware trimmer calibration
+ * of the boards without a stored parameter set.
+ */
+///@{
+#define CALIB_DEFAULT_OFFSET            50      //!< ADC offset of the position sensors
+#define CALIB_DEFAULT_X_GAIN            1000    //!< X ADC units / 100mm (1 unit = 0.1mm)
+#define CALIB_DEFAULT_Y_GAIN            2500    //!< Y ADC units / 100mm (2.5 unit = 0.1mm)
+#define CALIB_DEFAULT_Z_GAIN            2000    //!< Z ADC units / 100mm (2 unit = 0.1mm)
+#define CALIB_DEFAULT_X_MAX_dm          2580    //!< X max target position (0.1mm)
+#define CALIB_DEFAULT_Y_MAX_dm          700     //!< Y max target position (0.1mm)
+#define CALIB_DEFAULT_Z_MAX_dm          1450    //!< Z max target position (0.1mm)
+#define CALIB_DEFAULT_X_TIMEOUT         2000    //!< X activation timeout (7.8ms units: 15 seconds)
+#define CALIB_DEFAULT_Y_TIMEOUT         1200    //!< Y activation timeout (7.8ms units: 8 seconds)
+#define CALIB_DEFAULT_Z_TIMEOUT         2000    //!< Z activation timeout (7.8ms units: 15 seconds)
+#define CALIB_DEFAULT_OBSTACLE_BLANK    50      //!< Obstacle detection blank time from the activation start (7.8ms units)
+#define CALIB_DEFAULT_OBSTACLE_DELAY    15      //!< Obstacle detection test period (7.8ms units)
+#define CALIB_DEFAULT_OBSTACLE_DELTA    2       //!< Min position change in a test period (0.1mm)
+#define CALIB_DEFAULT_POWER_TABLE_0     5,10,20,30  //!< Distance thresholds (mm) of the power levels 1 to 4
+#define CALIB_DEFAULT_POWER_TABLE_1     40,50,100,0 //!< Distance thresholds (mm) of the power levels 5 to 7
+#define CALIB_DEFAULT_KEYSTEP_STEP      2       //!< Key Step single step (0.1mm)
+#define CALIB_DEFAULT_KEYSTEP_DELAY     40      //!< Key Step repeat delay (7.8ms units: 312ms)
+#define CALIB_DEFAULT_KEYSTEP_STAGE     2       //!< Key Step steps of a ramp stage
+#define CALIB_DEFAULT_KEYSTEP_MAX       10      //!< Key Step max step (mm)
+///@}
+
+/**
+ * \name Valid ranges of the calibration parameters
+ *
+ * The byte parameters are valid up to \ref CALIB_BYTE_MAX:
+ * 0xFF is the value of an erased SmartEEPROM.
+ */
+///@{
+#define CALIB_OFFSET_MIN    (-512)  //!< Min valid ADC offset
+#define CALIB_OFFSET_MAX    1023    //!< Max valid ADC offset
+#define CALIB_GAIN_MIN      100     //!< Min valid gain (ADC units / 100mm)
+#define CALIB_GAIN_MAX      20000   //!< Max valid gain (ADC units / 100mm)
+#define CALIB_MAX_dm_MAX    4000    //!< Max valid target position (0.1mm)
+#define CALIB_TIMEOUT_MAX   7680    //!< Max valid activation timeout (7.8ms units: 60 seconds)
+#define CALIB_BYTE_MAX      254     //!< Max valid value of the byte parameters
+///@}
+
+#define CALIB_LUT_SHIFT         8   //!< Log2 of the LUT segment width
+#define CALIB_LUT_WIDTH         (1 << CALIB_LUT_SHIFT) //!< LUT segment width (ADC units)
+#define CALIB_LUT_SEGMENTS      16  //!< Number of LUT segments (12 bit ADC range)
+#define CALIB_LUT_POINTS        (CALIB_LUT_SEGMENTS + 1) //!< Number of LUT breakpoints
+#define CALIB_LUT_REGISTERS     ((CALIB_LUT_POINTS + 1) / 2) //!< PARAMETER registers of an axis LUT (two breakpoints per register)
+#define CALIB_SWEEP_MAX_POINTS  32  //!< Max number of points of a calibration sweep
+
+/// Linearization segment
+typedef struct{
+    int64_t base;   //!< Q16 position at the segment start (0.1mm)
+    int32_t slope;  //!< Q16 slope (0.1mm / ADC unit)
+}CALIB_SEGMENT_t;
+
+/// Calibration data of an axis
+typedef struct{
+    int offset;         //!< ADC offset (ADC units)
+    int32_t k_dm;       //!< Q16 coefficient: ADC units to 0.1mm
+    int32_t k_units;    //!< Q16 coefficient: 0.1mm to ADC units
+    int max_dm;         //!< Max target position (0.1mm)
+    int timeout;        //!< Activation timeout (7.8ms units)
+    bool lut_valid;     //!< The linearization table comes from a calibration sweep
+    CALIB_SEGMENT_t lut[CALIB_LUT_SEGMENTS]; //!< Linearization table
+}CALIB_AXIS_DATA_t;
+
+/// Module data structure
+typedef struct{
+    CALIB_AXIS_DATA_t axis[CALIB_AXES]; //!< Axes calibration
+    int obstacle_blank;     //!< Obstacle detection blank time (7.8ms units)
+    int obstacle_delay;     //!< Obstacle detection test period (7.8ms units)
+    int obstacle_delta;     //!< Min position change in a test period (0.1mm)
+    int power_threshold[CALIB_POWER_LEVELS]; //!< Distance thresholds (0.1mm) of the power levels 1 to 7 (ascending)
+    int keystep_step;       //!< Key Step single step (0.1mm)
+    int keystep_delay;      //!< Key Step repeat delay (7.8ms units)
+    int keystep_stage;      //!< Key Step steps of a ramp stage
+    int keystep_max;        //!< Key Step max step (0.1mm)
+}CALIBRATION_t;
+
+/// Calibration data (RAM copy of the PARAMETER registers)
+ext CALIBRATION_t calibStruct;
+
+/// Truncates a Q16 value toward zero
+#define CALIB_Q16_TRUNC(q)      ((int) (((q) >= 0) ? ((q) >> 16) : -((-(q)) >> 16)))
+
+/// Converts ADC units (offset removed) into 0.1mm units (truncated)
+#define CALIB_TO_DM(ax, u)      CALIB_Q16_TRUNC((int64_t) (u) * calibStruct.axis[ax].k_dm)
+
+/// Converts 0.1mm units into ADC units (truncated)
+#define CALIB_TO_UNITS(ax, dm)  CALIB_Q16_TRUNC((int64_t) (dm) * calibStruct.axis[ax].k_units)
+
+/**
+ * This function converts ADC units (offset removed) 
+ * into the absolute position with the linearization table.
+ *
+ * @param ax axis
+ * @param u ADC value with the offset removed
+ * @return the position in 0.1mm units
+ */
+static inline int calibPosition(CALIB_AXIS_t ax, int u){
+    int i = u >> CALIB_LUT_SHIFT;
+    if(i < 0) i = 0;
+    else if(i >= CALIB_LUT_SEGMENTS) i = CALIB_LUT_SEGMENTS - 1;
+
+    const CALIB_SEGMENT_t* seg = &calibStruct.axis[ax].lut[i];
+    return CALIB_Q16_TRUNC(seg->base + (int64_t) (u - (i << CALIB_LUT_SHIFT)) * seg->slope);
+}
+
+/// Module initialization
+ext void calibrationInit(void);
+
+/// Converts the PARAMETER registers into the RAM coefficients
+ext void calibrationLoad(void);
+
+/// Starts a calibration sweep on an axis
+ext void calibrationSweepStart(CALIB_AXIS_t ax);
+
+/// Returns the axis of the pending calibration sweep (-1 if no sweep is pending)
+ext int calibrationSweepAxis(void);
+
+/// Adds a point to the pending calibration sweep
+ext int calibrationSweepPoint(int u, int pos_dm);
+
+/// Completes the pending calibration sweep and builds the axis LUT
+ext bool calibrationSweepEnd(void);
+
+/// Clears the LUT of an axis (linear conversion)
+ext void calibrationLutClear(CALIB_AXIS_t ax);
+
+/// Converts an absolute position into ADC units (offset removed, -1 if out of the table)
+ext int calibUnits(CALIB_AXIS_t ax, int pos);
+
+/** @}*/
+
+#endif // _CALIBRATION_H
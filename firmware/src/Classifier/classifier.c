@@ -0,0 +1,85 @@
+#define _CLASSIFIER_C
+
+#include "classifier.h"
+
+/**
+ * \addtogroup CLASSMOD
+ *
+ *  @{
+ */
+
+/**
+ * This function initializes the state of the sensors.
+ * 
+ * The code is set to the initial code of the descriptor:
+ * the change callback is not called.
+ * 
+ * @param sensor descriptors of the sensors
+ * @param state states of the sensors
+ * @param sensors number of sensors
+ */
+void classifierInit(const CLASSIFIER_SENSOR_t* sensor, CLASSIFIER_STATE_t* state, unsigned sensors){
+    for(unsigned i = 0; i < sensors; i++){
+        state[i].code = sensor[i].initial;
+        state[i].band = -1;
+        state[i].count = 0;
+    }
+}
+
+/**
+ * This function returns the band of a sample with the hysteresis.
+ * 
+ * A different band is returned only if the sample is beyond 
+ * the limit of the current band by the hysteresis.
+ * 
+ * @param sensor sensor descriptor
+ * @param current current band (-1 if not yet classified: no hysteresis)
+ * @param x sample
+ * @return the band of the sample
+ */
+static int classifierBand(const CLASSIFIER_SENSOR_t* sensor, int current, int x){
+    int band = 0;
+    
+    while((band < sensor->nbands - 1) && (x >= sensor->bands[band].limit)) band++;
+    
+    if((current < 0) || (band == current)) return band;
+    if((band > current) && (x < sensor->bands[current].limit + sensor->hysteresis)) return current;
+    if((band < current) && (x >= sensor->bands[current - 1].limit - sensor->hysteresis)) return current;
+    return band;
+}
+
+/**
+ * This function classifies all the sensors.
+ * 
+ * It shall be called every \ref CLASSIFIER_PERIOD_ms, after the update of the sensor samples.
+ * The change callback of a sensor is called when the new code has been 
+ * classified for the debounce time (at least one classification).
+ * 
+ * @param sensor descriptors of the sensors
+ * @param state states of the sensors
+ * @param sensors number of sensors
+ */
+void classifierRun(const CLASSIFIER_SENSOR_t* sensor, CLASSIFIER_STATE_t* state, unsigned sensors){
+    for(unsigned i = 0; i < sensors; i++, sensor++, state++){
+        int band = classifierBand(sensor, state->band, *sensor->sample);
+        uint8_t code = sensor->bands[band].code;
+        unsigned debounce = (sensor->debounce_ms + CLASSIFIER_PERIOD_ms / 2) / CLASSIFIER_PERIOD_ms;
+        
+        if(sensor->resolve) code = sensor->resolve(code);
+        
+        if(code == state->code){
+            state->band = (int8_t) band;
+            state->count = 0;
+            continue;
+        }
+        
+        if(++state->count < debounce) continue;
+        
+        state->code = code;
+        state->band = (int8_t) band;
+        state->count = 0;
+        if(sensor->changed) sensor->changed(code);
+    }
+}
+
+/** @}*/
@@ -0,0 +1,86 @@
+#ifndef _CLASSIFIER_H
+#define _CLASSIFIER_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#undef ext
+#undef ext_static
+
+#ifdef _CLASSIFIER_C
+    #define ext
+    #define ext_static static
+#else
+    #define ext extern
+    #define ext_static extern
+#endif
+
+/*!
+ * \defgroup CLASSMOD Sensor Classifier Module
+ * \ingroup applicationModule
+ *
+ * This module classifies the slow sensors of the device 
+ * (X-Scroll, Needle identification, Y flip) into status codes.
+ *
+ * ## Module Function Description
+ *
+ * Every sensor is described by a constant descriptor (\ref CLASSIFIER_SENSOR_t):
+ * + the sample: an int of the sensor snapshot, acquired by the application before the classification;
+ * + the threshold ladder: a table of bands with ascending upper limits (excluded), 
+ * each with its class code; the last band collects all the samples above the previous limit;
+ * + the hysteresis: a band change is accepted only when the sample is beyond 
+ * the limit of the current band by the hysteresis (sample units);
+ * + the debounce time: the new class shall be detected for the debounce time 
+ * (consecutive classifications) before the change;
+ * + an optional resolve function, that refines the code of a band with other signals;
+ * + the change callback, called with the new code (status register update, buzzer).
+ *
+ * The state of every sensor (\ref CLASSIFIER_STATE_t) is kept in a separate RAM array, 
+ * so the descriptors can be allocated in the program memory.
+ * Adding a sensor requires only its descriptor, its threshold table and its sample.
+ *
+ * ## Module API
+ *
+ * + classifierInit(): sets the initial code of the sensors;
+ * + classifierRun(): classifies all the sensors (periodic call every \ref CLASSIFIER_PERIOD_ms);
+ *
+ *  @{
+ */
+
+#define CLASSIFIER_PERIOD_ms    128 //!< Period of the classification (ms)
+#define CLASSIFIER_BANDS(table) ((uint8_t) (sizeof(table) / sizeof(table[0]))) //!< Number of bands of a threshold table
+
+/// Band of a threshold ladder
+typedef struct{
+    int limit;          //!< Upper limit of the band (excluded, sample units)
+    uint8_t code;       //!< Class code of the band
+}CLASSIFIER_BAND_t;
+
+/// Sensor descriptor
+typedef struct{
+    const int* sample;                  //!< Sample of the sensor snapshot
+    const CLASSIFIER_BAND_t* bands;     //!< Threshold ladder (ascending limits, the last band is open)
+    uint8_t nbands;                     //!< Number of bands of the ladder
+    uint8_t hysteresis;                 //!< Hysteresis around the limits (sample units)
+    uint16_t debounce_ms;               //!< The new class shall be stable for this time before the change
+    uint8_t initial;                    //!< Code before the first classification
+    uint8_t (*resolve)(uint8_t code);   //!< Optional refinement of the band code (NULL if not used)
+    void (*changed)(uint8_t code);      //!< Change callback (NULL if not used)
+}CLASSIFIER_SENSOR_t;
+
+/// Sensor classification state
+typedef struct{
+    uint8_t code;       //!< Current (debounced) code
+    int8_t band;        //!< Band of the current code (-1 before the first classification)
+    uint8_t count;      //!< Consecutive classifications of a different code
+}CLASSIFIER_STATE_t;
+
+/// Sets the initial code of the sensors
+ext void classifierInit(const CLASSIFIER_SENSOR_t* sensor, CLASSIFIER_STATE_t* state, unsigned sensors);
+
+/// Classifies the sensors (periodic call)
+ext void classifierRun(const CLASSIFIER_SENSOR_t* sensor, CLASSIFIER_STATE_t* state, unsigned sensors);
+
+/** @}*/
+
+#endif // _CLASSIFIER_H
@@ -3,28 +3,51 @@
 #include "application.h"
 #include "motors.h"
 #include "Protocol/protocol.h"
+#include "Trace/trace.h"
+#include "Calibration/calibration.h"
 #include "../main.h"
+#include "Profiler/profiler.h"
 
 #define TIMER_TIC_us 7800
 #define TIME_us_TIC(x) (x/TIMER_TIC_us)
 
 #define MOTOR_HOLD_TIME 80
+#define MOTOR_KEYSTEP_HOLD_TIME 8 //!< Position hold time of a Key Step jog step (7.8ms units)
+#define MOTOR_KEYSTEP_NO_KEY    -1 //!< Key Step: no key pressed
+#define MOTOR_INTERLOCK_KEY_CHANNEL 3 //!< EVSYS channel of the key EIC event (CCL LUTIN0, see EVSYS_Initialize())
 
 
 #define MOTOR_CALIB_MODE_KEEP_ALIVE_7ms 8561 
 
-#define MOTOR_X_TIMEOUT 2000 // 15 seconds
-#define MOTOR_Y_TIMEOUT 1200 // 8 seconds
-#define MOTOR_Z_TIMEOUT 2000 // 15 seconds
+#define MOTOR_SUPPLY_NOMINAL    240 //!< Nominal motor supply (0.1V)
+#define MOTOR_SUPPLY_MIN        120 //!< Below this supply (0.1V) the power is not compensated
+#define MOTOR_SUPPLY_SAG        216 //!< Supply sag threshold (0.1V, 90% of the nominal)
+#define MOTOR_SUPPLY_SAG_HYST   10  //!< Supply sag hysteresis (0.1V)
+#define MOTOR_OVERCURRENT_DROP  75  //!< Over-current threshold (% of the filtered supply)
+
+/// Motor supply sag detection data
+static struct{
+    bool sag;               //!< A supply sag is in progress
+    int min;                //!< Minimum supply of the sag (0.1V)
+    unsigned char power;    //!< Power at the minimum supply (%)
+    int ticks;              //!< Sag duration (7.8ms units)
+}motorSupply;
+
+#ifdef _PROFILER_ENABLED_
+#define MOTOR_STOP_TEST_SAMPLES 16  //!< Number of samples of each path of the stop latency test
+#define MOTOR_STOP_TEST_TIMEOUT 1200 //!< Readback timeout of a stop latency sample (cycles, 10us)
+
+/// Stop latency test data (see motorStopLatencyTest())
+static volatile struct{
+    bool request;           //!< The ADC0 WINMON handler executes the stop path without an activation
+    uint32_t stop;          //!< Cycle counter at the MOT_STOP low readback of the handler (0 = not low)
+}motorStopTest;
+#endif
 
 // Change Working mode request from other sources
 bool change_mode_request = false;
 int change_mode;
 
-#define MAX_Z_POSITION_dm 1450
-#define MAX_X_POSITION_dm 2580
-#define MAX_Y_POSITION_dm 700
-
 // #define abs(x) (x<0) ? (-(x)): (x)
 
 static int abs(int val){
@@ -32,13 +55,16 @@ static int abs(int val){
     else return val;
 }
 
-static void motorActivationHandler(void);
+static void HOT_CODE motorActivationHandler(void);
+
 
 
+/// Supply voltage of the power levels (% of 24V)
+static const unsigned char motorLevelPercent[CALIB_POWER_LEVELS + 1] = {38, 42, 46, 50, 65, 71, 85, 100};
 
 /**
  * \ingroup MOTMOD
- * This function allows to select up to 7 power levels:
+ * This function sets the VSEL outputs of the driver supply:
  * 
  * |Level|Voltage (respect 24V) |
  * |:--|:--|
@@ -49,11 +75,12 @@ static void motorActivationHandler(void);
  * |4|65%|
  * |5|71%|
  * |6|85%|
+ * |7|100%|
  * 
  * @param val: this is the requested power level
  * 
  */
-static void motorSetPower(unsigned char val){
+static void motorSetVsel(unsigned char val){
     if(val > 7) val = 7;
     val = 7 - val;
     motorStruct.power = val;
@@ -68,6 +95,184 @@ static void motorSetPower(unsigned char val){
     return;
 }
 
+/**
+ * \ingroup MOTMOD
+ * This function compensates a power command with the measured motor supply.
+ * 
+ * The command is scaled with the ratio between the nominal (24V) 
+ * and the measured supply, so the effective motor voltage is constant.
+ * The power is not compensated if the supply is not available
+ * (less than \ref MOTOR_SUPPLY_MIN).
+ * 
+ * @param percent: requested power (% of the nominal supply)
+ * @return the compensated power (0 to 100%)
+ */
+static int motorSupplyCompensation(int percent){
+    int supply = deviceStruct.sensors.power_supply;
+    
+    if(supply < MOTOR_SUPPLY_MIN) return percent;
+    
+    percent = (percent * MOTOR_SUPPLY_NOMINAL + supply / 2) / supply;
+    if(percent > 100) percent = 100;
+    return percent;
+}
+
+/**
+ * \ingroup MOTMOD
+ * This function sets the motor power as a percentage of the nominal 24V supply.
+ * 
+ * The power is compensated with the measured supply (see motorSupplyCompensation()).
+ * 
+ * With the PWM power control (_MOTOR_PWM_ENABLED_) the supply is set to the
+ * maximum level and the power is the duty cycle of the MOT_STOP PWM (20kHz):
+ * the power is continuous from 0 to 100%.
+ * 
+ * Without the PWM power control, the power is set to the VSEL level
+ * nearest to the compensated percentage.
+ * 
+ * @param percent: requested power (0 to 100%)
+ */
+void motorSetPowerPercent(unsigned char percent){
+    if(percent > 100) percent = 100;
+    motorStruct.power_percent = percent;
+    
+    int power = motorSupplyCompensation(percent);
+    
+#ifdef _MOTOR_PWM_ENABLED_
+    motorSetVsel(CALIB_POWER_LEVELS);
+    
+    // NPWM: the output is high from the counter ZERO to the CC0 match
+    TCC0_PWM24bitDutySet(TCC0_CHANNEL0, ((TCC0_PWM24bitPeriodGet() + 1) * power) / 100);
+#else
+    unsigned char val, sel = 0;
+    for(val = 1; val <= CALIB_POWER_LEVELS; val++){
+        if(abs(motorLevelPercent[val] - power) < abs(motorLevelPercent[sel] - power)) sel = val;
+    }
+    motorSetVsel(sel);
+#endif
+    return;
+}
+
+/**
+ * \ingroup MOTMOD
+ * This function selects one of the power levels.
+ * 
+ * The level is converted to the supply voltage percentage 
+ * and it is compensated with the measured supply (see motorSetPowerPercent()).
+ * 
+ * @param val: this is the requested power level
+ */
+static void motorSetPower(unsigned char val){
+    if(val > CALIB_POWER_LEVELS) val = CALIB_POWER_LEVELS;
+    motorSetPowerPercent(motorLevelPercent[val]);
+    return;
+}
+
+/**
+ * \ingroup MOTMOD
+ * This function detects the motor supply sags.
+ * 
+ * A sag starts when the supply falls below \ref MOTOR_SUPPLY_SAG 
+ * with the driver enabled, and it ends when the supply rises above
+ * the threshold plus \ref MOTOR_SUPPLY_SAG_HYST or the driver is disabled.
+ * 
+ * At the end of the sag a TRACE_SUPPLY_SAG event is recorded with 
+ * the minimum supply, the power requested at the minimum and the duration.
+ * 
+ * The function is called every 7.8ms by the motor loop.
+ */
+static void motorSupplySagDetection(void){
+    int supply = deviceStruct.sensors.power_supply;
+    bool enabled = (motorStruct.mode != MOTORS_DISABLED);
+    
+    if(!motorSupply.sag){
+        if((!enabled) || (supply >= MOTOR_SUPPLY_SAG)) return;
+        motorSupply.sag = true;
+        motorSupply.min = supply;
+        motorSupply.power = motorStruct.power_percent;
+        motorSupply.ticks = 0;
+        return;
+    }
+    
+    if(motorSupply.ticks < 0xFFFF) motorSupply.ticks++;
+    if(supply < motorSupply.min){
+        motorSupply.min = supply;
+        motorSupply.power = motorStruct.power_percent;
+    }
+    
+    if((enabled) && (supply < MOTOR_SUPPLY_SAG + MOTOR_SUPPLY_SAG_HYST)) return;
+    
+    motorSupply.sag = false;
+    traceEvent(TRACE_SUPPLY_SAG, (uint8_t) motorSupply.min, motorSupply.power, (uint8_t) (motorSupply.ticks & 0xff), (uint8_t) ((motorSupply.ticks >> 8) & 0xff));
+}
+
+#ifdef _MOTOR_PWM_ENABLED_
+/**
+ * \ingroup MOTMOD
+ * This function initializes the PWM power control.
+ * 
+ * The TCC0 (20kHz, see powerLightInit()) is configured by the Harmony
+ * with the dead time insertion on all the outputs: the WO[0] would be
+ * the inverted low side output. The dead time insertion is removed
+ * from the WO[0] (WEXCTRL is enable protected) and the PWM is started
+ * with the duty cycle set to 0%.
+ * 
+ * The PA08 (MOT_STOP) is assigned to the TCC0/WO[0] (peripheral function F):
+ * the pin is switched to the PWM only during the motor activation
+ * (see motorPwmOutput()).
+ */
+static void motorPwmInit(void){
+    TCC0_PWMStop();
+    TCC0_REGS->TCC_WEXCTRL &= ~TCC_WEXCTRL_DTIEN0_Msk;
+    TCC0_REGS->TCC_CC[0] = 0U;
+    while ((TCC0_REGS->TCC_SYNCBUSY & TCC_SYNCBUSY_CC0_Msk) != 0U);
+    TCC0_PWMStart();
+    
+    PORT_REGS->GROUP[0].PORT_PMUX[uc_MOT_STOP_PIN >> 1] = (PORT_REGS->GROUP[0].PORT_PMUX[uc_MOT_STOP_PIN >> 1] & (uint8_t) ~PORT_PMUX_PMUXE_Msk) | PORT_PMUX_PMUXE_F;
+}
+
+/**
+ * \ingroup MOTMOD
+ * This function connects the MOT_STOP pin to the PWM or to the GPIO.
+ * 
+ * When the pin is released from the PWM, the GPIO level is restored:
+ * high in the activation modes, low in the short (brake) and disabled modes.
+ * 
+ * @param pwm: true to connect the pin to the TCC0/WO[0] output
+ */
+static void motorPwmOutput(bool pwm){
+    if(pwm) PORT_REGS->GROUP[0].PORT_PINCFG[uc_MOT_STOP_PIN] |= PORT_PINCFG_PMUXEN_Msk;
+    else PORT_REGS->GROUP[0].PORT_PINCFG[uc_MOT_STOP_PIN] &= (uint8_t) ~PORT_PINCFG_PMUXEN_Msk;
+}
+#endif
+
+/**
+ * \ingroup MOTMOD
+ * This function returns true if a driver mode moves a motor.
+ * 
+ * @param mode: driver output mode
+ * @return true for the direction modes, false for the disabled and short modes
+ */
+static bool motorIsDriving(MOTOR_MODE_t mode){
+    return (mode != MOTORS_DISABLED) && (mode != MOTOR_X_SHORT) && (mode != MOTOR_Y_SHORT) && (mode != MOTOR_Z_SHORT);
+}
+
+/**
+ * \ingroup MOTMOD
+ * This function returns the short mode of the axis of a driver mode.
+ * 
+ * @param mode: driver output mode
+ * @return the short mode of the same axis (MOTORS_DISABLED is returned unchanged)
+ */
+static MOTOR_MODE_t motorShortMode(MOTOR_MODE_t mode){
+    switch(mode){
+        case MOTOR_X_LEFT: case MOTOR_X_RIGHT: return MOTOR_X_SHORT;
+        case MOTOR_Y_HOME: case MOTOR_Y_FIELD: return MOTOR_Y_SHORT;
+        case MOTOR_Z_UP: case MOTOR_Z_DOWN: return MOTOR_Z_SHORT;
+        default: return mode;
+    }
+}
+
 /**
  * \ingroup MOTMOD
  * This function sets the current driver activation mode.
@@ -87,6 +292,15 @@ static void motorSetPower(unsigned char val){
  * @param mode: this is the requested driver output mode
  */
 static void motorDriverOutput(MOTOR_MODE_t mode){
+    bool irq = NVIC_INT_Disable();
+    
+    // A stop of the interrupt handlers (target reached, over-current, keys released, abort, power switch) is not overridden
+    if((motorStruct.command_mode.command != MOTOR_COMMAND_NO_COMMAND) &&
+       (motorStruct.command_mode.target_reached || motorStruct.command_mode.overcurrent || motorStruct.command_mode.key_released ||
+        motorStruct.command_mode.abort_request || motorStruct.command_mode.power_dropped)){
+        mode = motorShortMode(mode);
+    }
+    
     motorStruct.mode = mode;
     
     switch(mode){
@@ -160,6 +374,313 @@ static void motorDriverOutput(MOTOR_MODE_t mode){
             break;
 
     }
+    
+#ifdef _MOTOR_PWM_ENABLED_
+    motorPwmOutput(motorIsDriving(mode));
+#endif
+    NVIC_INT_Restore(irq);
+}
+
+/**
+ * \ingroup MOTMOD
+ * This function brakes the motor from an interrupt handler.
+ * 
+ * The driver is set in the short mode of the moving axis (MOT_STOP low):
+ * the other driver outputs are already set by the activation mode.
+ */
+static void motorInterruptBrake(void){
+    uc_MOT_STOP_Clear();
+#ifdef _MOTOR_PWM_ENABLED_
+    motorPwmOutput(false);
+#endif
+    motorStruct.mode = motorShortMode(motorStruct.mode);
+}
+
+/**
+ * \ingroup MOTMOD
+ * This function returns the over-current threshold of the motor supply conversion.
+ * 
+ * The board has not a motor current sense input: the over-current (stalled motor)
+ * is detected as a fast drop of the motor supply (ANL_MONITOR_VM) 
+ * below \ref MOTOR_OVERCURRENT_DROP % of the filtered supply value.
+ * 
+ * The detection is armed only during the motion of a command activation, 
+ * after the obstacle blank time (the motor start current is not an over-current).
+ * 
+ * @return the threshold in ADC1 units (8 bit) or 0 if the detection is not armed
+ */
+uint16_t motorOverCurrentThreshold(void){
+    int supply = deviceStruct.sensors.power_supply;
+    
+    if(motorStruct.command_mode.command == MOTOR_COMMAND_NO_COMMAND) return 0;
+    if(motorStruct.command_mode.termination_fase) return 0;
+    if(motorStruct.command_mode.activation_timer <= calibStruct.obstacle_blank) return 0;
+    if(!motorIsDriving(motorStruct.mode)) return 0;
+    if(supply < MOTOR_SUPPLY_MIN) return 0;
+    
+    // 0.1V to ADC units (1V -> 0.125V, 3.3V / 255)
+    return (uint16_t) ((supply * MOTOR_OVERCURRENT_DROP * 255) / (100 * 33 * 8));
+}
+
+/**
+ * \ingroup MOTMOD
+ * This is the ADC1 WINMON interrupt handler (over-current detection).
+ * 
+ * The motor is braked at the end of the conversion (MOT_STOP low),
+ * then the activation handler terminates the command with the 
+ * MOTOR_ERROR_OVERCURRENT error code.
+ */
+void ADC1_OTHER_Handler(void){
+    PROFILE_BEGIN(PROFILE_STOP_ISR);
+    ADC1_InterruptsDisable(ADC_STATUS_WINMON);
+    ADC1_InterruptsClear(ADC_STATUS_WINMON);
+    
+    motorInterruptBrake();
+    motorStruct.command_mode.overcurrent = true;
+    PROFILE_END(PROFILE_STOP_ISR);
+}
+
+/**
+ * \ingroup MOTMOD
+ * This is the ADC0 WINMON interrupt handler (target band reached).
+ * 
+ * The position channel converts in free running mode during the activation:
+ * the motor is braked within one conversion (7us) from the target band entry, 
+ * then the activation handler completes the command with success.
+ * With the _PROFILER_ENABLED_ option the handler brakes also for the stop latency test
+ * (see motorStopLatencyTest()).
+ */
+void ADC0_OTHER_Handler(void){
+    ADC0_InterruptsDisable(ADC_STATUS_WINMON);
+    ADC0_InterruptsClear(ADC_STATUS_WINMON);
+    
+#ifdef _PROFILER_ENABLED_
+    if(motorStopTest.request){
+        motorInterruptBrake();
+        motorStopTest.stop = (uc_MOT_STOP_Get()) ? 0 : PROFILER_TIMESTAMP();
+        return;
+    }
+#endif
+    if((motorStruct.command_mode.command == MOTOR_COMMAND_NO_COMMAND) || (motorStruct.command_mode.termination_fase)) return;
+    
+    PROFILE_BEGIN(PROFILE_STOP_ISR);
+    motorInterruptBrake();
+    motorStruct.command_mode.target_reached = true;
+    PROFILE_END(PROFILE_STOP_ISR);
+}
+
+/**
+ * \ingroup MOTMOD
+ * This function stops a key requested activation at the release of the keys.
+ * 
+ * It is called by the keyboard interrupt (see KeyboardEventHandler() in main.c):
+ * the motor is braked immediately (position hold), then the activation handler 
+ * terminates the command with the MOTOR_ERROR_KEY_RELEASED error code.
+ */
+void motorKeyReleased(void){
+    if(motorStruct.command_mode.command == MOTOR_COMMAND_NO_COMMAND) return;
+    if((motorStruct.command_mode.termination_fase) || (!motorStruct.command_mode.key_requested)) return;
+    
+    motorInterruptBrake();
+    motorStruct.command_mode.key_released = true;
+}
+
+/**
+ * \ingroup MOTMOD
+ * This function is the ABORT fast path of the CAN protocol.
+ * 
+ * It is called by the CAN reception interrupt as soon as an ABORT command frame
+ * is received (see MET_Can_Protocol_SetAbortHandler()): the motor is braked 
+ * immediately (position hold) and the abort is requested, without waiting 
+ * for the main loop to process the frame.
+ * The activation handler then terminates the command with the MET_CAN_COMMAND_ABORT_CODE,
+ * and the command handler returns the protocol answer (motorAbort()).
+ */
+void motorAbortFast(void){
+    if(motorStruct.command_mode.command == MOTOR_COMMAND_NO_COMMAND) return;
+    if(motorStruct.command_mode.termination_fase) return;
+    
+    motorInterruptBrake();
+    motorStruct.command_mode.abort_request = true;
+}
+
+/**
+ * \ingroup MOTMOD
+ * This function stops an activation at the drop of the motor power switch.
+ * 
+ * It is called by the safety feedback interrupt (see SafetyFeedbackEventHandler() in main.c)
+ * on the falling edge of the MOTOR_ENA_FEEDBACK input: the motor is braked immediately
+ * and the activation handler terminates the command with the MOTOR_ERROR_POWER_SWITCH error code.
+ */
+void motorPowerSwitchDropped(void){
+    if(motorStruct.command_mode.command == MOTOR_COMMAND_NO_COMMAND) return;
+    if(motorStruct.command_mode.termination_fase) return;
+    
+    motorInterruptBrake();
+    motorStruct.command_mode.power_dropped = true;
+}
+
+/**
+ * \ingroup MOTMOD
+ * This function arms the hardware stop chain of a command activation.
+ * 
+ * The PORT event inputs 0 (ADC0 WINMON) and 1 (ADC1 WINMON) clear the 
+ * MOT_STOP pin: the event selection is written with the inputs disabled, 
+ * then the inputs are enabled.
+ * 
+ * The chain is not armed with the PWM power control (MOT_STOP driven by the TCC0).
+ */
+void motorStopChainArm(void){
+#ifndef _MOTOR_PWM_ENABLED_
+    uint32_t evctrl = PORT_EVCTRL_PID0(uc_MOT_STOP_PIN) | PORT_EVCTRL_EVACT0_CLR | PORT_EVCTRL_PID1(uc_MOT_STOP_PIN) | PORT_EVCTRL_EVACT1(PORT_EVCTRL_EVACT0_CLR_Val);
+    uint32_t portei = PORT_EVCTRL_PORTEI0_Msk | PORT_EVCTRL_PORTEI1_Msk;
+    
+    // CCL interlock (PORT event input 2): motor power switch and the button of a key requested activation
+    if(motorStruct.interlock.enabled){
+        uint8_t key = ((motorStruct.interlock.keys) && (motorStruct.command_mode.key_requested)) ? KeyboardEventGenerator() : 0;
+        
+        EVSYS_REGS->CHANNEL[MOTOR_INTERLOCK_KEY_CHANNEL].EVSYS_CHANNEL = EVSYS_CHANNEL_EVGEN(key) | EVSYS_CHANNEL_PATH(2U);
+        evctrl |= PORT_EVCTRL_PID2(uc_MOT_STOP_PIN) | PORT_EVCTRL_EVACT2(PORT_EVCTRL_EVACT0_CLR_Val);
+        portei |= PORT_EVCTRL_PORTEI2_Msk;
+        StatusModeRegister.interlock_armed = motorStruct.interlock.armed = true;
+    }
+    
+    PORT_REGS->GROUP[0].PORT_EVCTRL = 0;
+    PORT_REGS->GROUP[0].PORT_EVCTRL = evctrl;
+    PORT_REGS->GROUP[0].PORT_EVCTRL = evctrl | portei;
+#endif
+}
+
+/**
+ * \ingroup MOTMOD
+ * This function disarms the hardware stop chain and the CCL interlock:
+ * the MOT_STOP pin is driven by the software only.
+ */
+void motorStopChainDisarm(void){
+    PORT_REGS->GROUP[0].PORT_EVCTRL = 0;
+    EVSYS_REGS->CHANNEL[MOTOR_INTERLOCK_KEY_CHANNEL].EVSYS_CHANNEL = EVSYS_CHANNEL_EVGEN(0U) | EVSYS_CHANNEL_PATH(2U);
+    StatusModeRegister.interlock_armed = motorStruct.interlock.armed = false;
+}
+
+#ifdef _PROFILER_ENABLED_
+/**
+ * \ingroup MOTMOD
+ * This function measures the stop latency of the hardware chain and of the WINMON interrupt.
+ * 
+ * The test runs only with the driver disabled (no motion) and no activation in progress.
+ * Every sample sets MOT_STOP high, samples the cycle counter and starts the stop:
+ * + hardware chain: the PORT event input 0 is armed and a software event 
+ * is generated on the EVSYS channel 0 (the channel of the ADC0 WINMON event): 
+ * the time is sampled at the first MOT_STOP low readback;
+ * + WINMON interrupt: the ADC0_OTHER interrupt is set pending and its handler 
+ * executes the brake of the target band: the time is sampled by the handler 
+ * at the MOT_STOP low readback, after the exception entry
+ * (the activation checks of the handler, two loads, are not included).
+ * 
+ * The samples are recorded in the PROFILE_STOP_HW_TEST and PROFILE_STOP_SW_TEST probes
+ * (CPU cycles). Both paths start at the EVSYS channel or at the NVIC: 
+ * the end of the conversion and the ADC event output are common to both paths and not included.
+ * The readback includes the PORT input synchronization (on demand sampling), 
+ * the same for both paths. 
+ * The MOT_STOP input buffer is enabled during the test only, 
+ * then the pin configuration and the output level are restored.
+ * 
+ * The test is executed at the startup and at the PROFILER RESET command.
+ * It is not available with the PWM power control (MOT_STOP driven by the TCC0).
+ * 
+ * @return true if the test is executed
+ */
+bool motorStopLatencyTest(void){
+#ifdef _MOTOR_PWM_ENABLED_
+    return false;
+#else
+    if(motorStruct.command_mode.command != MOTOR_COMMAND_NO_COMMAND) return false;
+    if(motorStruct.mode != MOTORS_DISABLED) return false;
+    
+    uint8_t pincfg = PORT_REGS->GROUP[0].PORT_PINCFG[uc_MOT_STOP_PIN];
+    uint32_t out = PORT_REGS->GROUP[0].PORT_OUT & ((uint32_t)1U << uc_MOT_STOP_PIN);
+    PORT_REGS->GROUP[0].PORT_PINCFG[uc_MOT_STOP_PIN] = pincfg | PORT_PINCFG_INEN_Msk;
+    
+    for(int i = 0; i < MOTOR_STOP_TEST_SAMPLES; i++){
+        uint32_t t0;
+        uint32_t t;
+        
+        // Hardware chain: EVSYS channel 0 -> PORT event input 0 -> MOT_STOP clear
+        uc_MOT_STOP_Set();
+        PORT_REGS->GROUP[0].PORT_EVCTRL = PORT_EVCTRL_PID0(uc_MOT_STOP_PIN) | PORT_EVCTRL_EVACT0_CLR;
+        PORT_REGS->GROUP[0].PORT_EVCTRL = PORT_EVCTRL_PID0(uc_MOT_STOP_PIN) | PORT_EVCTRL_EVACT0_CLR | PORT_EVCTRL_PORTEI0_Msk;
+        
+        bool irq = NVIC_INT_Disable();
+        t0 = PROFILER_TIMESTAMP();
+        EVSYS_REGS->EVSYS_SWEVT = EVSYS_SWEVT_CHANNEL0_Msk;
+        do t = PROFILER_TIMESTAMP(); while((uc_MOT_STOP_Get()) && (t - t0 < MOTOR_STOP_TEST_TIMEOUT));
+        NVIC_INT_Restore(irq);
+        if(!uc_MOT_STOP_Get()) profilerRecord(PROFILE_STOP_HW_TEST, t - t0);
+        PORT_REGS->GROUP[0].PORT_EVCTRL = 0;
+        
+        // WINMON interrupt: ADC0_OTHER pending -> handler -> MOT_STOP clear
+        uc_MOT_STOP_Set();
+        motorStopTest.stop = 0;
+        motorStopTest.request = true;
+        t0 = PROFILER_TIMESTAMP();
+        NVIC_SetPendingIRQ(ADC0_OTHER_IRQn);
+        do t = PROFILER_TIMESTAMP(); while((!motorStopTest.stop) && (t - t0 < MOTOR_STOP_TEST_TIMEOUT));
+        motorStopTest.request = false;
+        if(motorStopTest.stop) profilerRecord(PROFILE_STOP_SW_TEST, motorStopTest.stop - t0);
+    }
+    
+    if(out) uc_MOT_STOP_Set();
+    else uc_MOT_STOP_Clear();
+    PORT_REGS->GROUP[0].PORT_PINCFG[uc_MOT_STOP_PIN] = pincfg;
+    return true;
+#endif
+}
+#endif
+
+#ifndef _MOTOR_PWM_ENABLED_
+/**
+ * \ingroup MOTMOD
+ * This function returns true if the button of the activation is an interlock input in a working mode.
+ * 
+ * @param mode working mode (see STATUS_WORKING_MODE_t)
+ * @return true in CALIB_MODE, and in COMMAND_MODE with the Key Step enabled
+ */
+static bool motorInterlockKeys(int mode){
+    return (mode == CALIB_MODE) || ((mode == COMMAND_MODE) && (deviceStruct.keyboard.flags.keystep));
+}
+#endif
+
+/**
+ * \ingroup MOTMOD
+ * This function configures the CCL interlock for a working mode.
+ * 
+ * |MODE|INTERLOCK INPUTS|
+ * |:--|:--|
+ * |CALIB_MODE|motor power switch and the button of the activation|
+ * |COMMAND_MODE|motor power switch; with the Key Step enabled also the button of a continuous jog|
+ * |DISABLE_MODE, SERVICE_MODE|disabled|
+ * 
+ * The configuration is applied to the following activations (see motorStopChainArm()).
+ * The Key Step flag can change also without a mode change (SetKeyMode()):
+ * the motor loop applies it again before every activation (see motorLoop()).
+ * The interlock is not available with the PWM power control (MOT_STOP driven by the TCC0).
+ * 
+ * @param mode working mode (see STATUS_WORKING_MODE_t)
+ */
+void motorInterlockConfig(int mode){
+#ifndef _MOTOR_PWM_ENABLED_
+    motorStruct.interlock.enabled = (mode == CALIB_MODE) || (mode == COMMAND_MODE);
+    motorStruct.interlock.keys = motorInterlockKeys(mode);
+#else
+    motorStruct.interlock.enabled = false;
+    motorStruct.interlock.keys = false;
+#endif
+    
+    if(motorStruct.interlock.enabled) CCL_Enable();
+    else CCL_Disable();
+    
+    StatusModeRegister.interlock_enabled = motorStruct.interlock.enabled;
+    StatusModeRegister.interlock_keys = motorStruct.interlock.keys;
 }
 
 
@@ -305,17 +826,23 @@ void motorCalibModeManagement(void){
 }
 
 
+/**
+ * \ingroup MOTMOD
+ * This function returns the power level for a given distance from the target.
+ * 
+ * The level N is selected when the distance is greater than
+ * the Level N threshold of the calibration power table (see \ref CALIBMOD).
+ * 
+ * @param distance distance from the target (0.1mm)
+ * @param min_power minimum level to be returned
+ * @return the power level
+ */
 unsigned char getPowerFromDistance(int distance, int min_power){
    
     int val;
-    if(distance > 1000) val = 7;
-    else if(distance > 500)  val = 6;
-    else if(distance > 400)  val = 5;
-    else if(distance > 300)  val = 4;
-    else if(distance > 200)  val = 3;
-    else if(distance > 100)  val = 2;
-    else if(distance > 50)   val = 1;
-    else val = 0;
+    for(val = CALIB_POWER_LEVELS; val > 0; val--){
+        if(distance > calibStruct.power_threshold[val-1]) break;
+    }
     
     if(val < min_power) val = min_power;
     
@@ -323,6 +850,61 @@ unsigned char getPowerFromDistance(int distance, int min_power){
     
 }
 
+/**
+ * \ingroup MOTMOD
+ * This function returns the power percentage for a given distance from the target.
+ * 
+ * The power is interpolated between the voltages of the power levels:
+ * the Level N voltage is reached when the distance is equal to 
+ * the Level N threshold of the calibration power table (see \ref CALIBMOD).
+ * Below the Level 1 threshold the power is interpolated from the Level 0 voltage
+ * (distance 0) and above the Level 7 threshold the power is 100%.
+ * 
+ * @param distance distance from the target (0.1mm)
+ * @param min_power minimum level to be returned
+ * @return the power (0 to 100%)
+ */
+unsigned char getPowerPercentFromDistance(int distance, int min_power){
+    int val, percent, lo, hi;
+    
+    for(val = CALIB_POWER_LEVELS; val > 0; val--){
+        if(distance > calibStruct.power_threshold[val-1]) break;
+    }
+    
+    if(val == CALIB_POWER_LEVELS) percent = motorLevelPercent[val];
+    else{
+        // Distance between the level val and the level val + 1 thresholds
+        lo = (val) ? calibStruct.power_threshold[val-1] : 0;
+        hi = calibStruct.power_threshold[val];
+        if((distance <= lo) || (hi <= lo)) percent = motorLevelPercent[val];
+        else percent = motorLevelPercent[val] + ((motorLevelPercent[val+1] - motorLevelPercent[val]) * (distance - lo)) / (hi - lo);
+    }
+    
+    if(min_power > CALIB_POWER_LEVELS) min_power = CALIB_POWER_LEVELS;
+    if((min_power > 0) && (percent < motorLevelPercent[min_power])) percent = motorLevelPercent[min_power];
+    
+    return (unsigned char) percent;
+}
+
+/**
+ * \ingroup MOTMOD
+ * This function sets the motor power for a given distance from the target.
+ * 
+ * With the PWM power control the power is continuous
+ * (see getPowerPercentFromDistance()), otherwise one of the power levels
+ * is selected (see getPowerFromDistance()).
+ * 
+ * @param distance distance from the target (0.1mm)
+ * @param min_power minimum level to be used
+ */
+static void motorSetPowerFromDistance(int distance, int min_power){
+#ifdef _MOTOR_PWM_ENABLED_
+    motorSetPowerPercent(getPowerPercentFromDistance(distance, min_power));
+#else
+    motorSetPower(getPowerFromDistance(distance, min_power));
+#endif
+}
+
 /**
  * \addtogroup MOTMOD
  * 
@@ -340,7 +922,7 @@ unsigned char getPowerFromDistance(int distance, int min_power){
 
 
 void motorServiceModeManagement(void){
-    int distance;
+    int pos_dm;
     int abs_dm_distance;
     int min_power;
     
@@ -367,11 +949,11 @@ void motorServiceModeManagement(void){
 
             case 1: // Move Z up to 10
                 
-                if(deviceStruct.sensors.z > Zdm_To_Units(100)){  
+                pos_dm = calibPosition(CALIB_AXIS_Z, deviceStruct.sensors.z);
+                if(pos_dm > 100){  
                     min_power = 2;
-                    distance = Zdm_To_Units(100) - deviceStruct.sensors.z;
-                    abs_dm_distance = Z_To_dm(abs(distance));
-                    motorSetPower(getPowerFromDistance(abs_dm_distance,min_power));
+                    abs_dm_distance = abs(100 - pos_dm);
+                    motorSetPowerFromDistance(abs_dm_distance,min_power);
                     motorDriverOutput(MOTOR_Z_UP);
                 }else{ 
                     motorDriverOutput(MOTOR_Z_SHORT);
@@ -380,11 +962,11 @@ void motorServiceModeManagement(void){
                 break;
 
             case 2: // Move X to 240
-                if(deviceStruct.sensors.x < Xdm_To_Units(2400)){  
+                pos_dm = calibPosition(CALIB_AXIS_X, deviceStruct.sensors.x);
+                if(pos_dm < 2400){  
                     min_power = 0;
-                    distance = Xdm_To_Units(2400) - deviceStruct.sensors.x;
-                    abs_dm_distance = X_To_dm(abs(distance));
-                    motorSetPower(getPowerFromDistance(abs_dm_distance,min_power));
+                    abs_dm_distance = abs(2400 - pos_dm);
+                    motorSetPowerFromDistance(abs_dm_distance,min_power);
                     motorDriverOutput(MOTOR_X_LEFT);
                 }else{ 
                     motorDriverOutput(MOTOR_X_SHORT);
@@ -393,11 +975,11 @@ void motorServiceModeManagement(void){
                 break;
 
            case 3: // Move Y to 60
-               if(deviceStruct.sensors.y < Ydm_To_Units(600)){  
+               pos_dm = calibPosition(CALIB_AXIS_Y, deviceStruct.sensors.y);
+               if(pos_dm < 600){  
                    min_power = 0;
-                   distance = Ydm_To_Units(600) - deviceStruct.sensors.y;
-                   abs_dm_distance = Y_To_dm(abs(distance));
-                   motorSetPower(getPowerFromDistance(abs_dm_distance,min_power));
+                   abs_dm_distance = abs(600 - pos_dm);
+                   motorSetPowerFromDistance(abs_dm_distance,min_power);
                    motorDriverOutput(MOTOR_Y_FIELD);
                }else{ 
                    motorDriverOutput(MOTOR_Y_SHORT);
@@ -406,11 +988,11 @@ void motorServiceModeManagement(void){
            break;
 
            case 4: // Move Y to 0
-               if(deviceStruct.sensors.y > 0){  
+               pos_dm = calibPosition(CALIB_AXIS_Y, deviceStruct.sensors.y);
+               if(pos_dm > 0){  
                    min_power = 0;
-                   distance = 0 - deviceStruct.sensors.y;
-                   abs_dm_distance = Y_To_dm(abs(distance));
-                   motorSetPower(getPowerFromDistance(abs_dm_distance,min_power));
+                   abs_dm_distance = abs(pos_dm);
+                   motorSetPowerFromDistance(abs_dm_distance,min_power);
                    motorDriverOutput(MOTOR_Y_HOME);
                }else{ 
                    motorDriverOutput(MOTOR_Y_SHORT);
@@ -419,11 +1001,11 @@ void motorServiceModeManagement(void){
            break;
 
            case 5: // Move X to 0
-           if(deviceStruct.sensors.x > 0){  
+           pos_dm = calibPosition(CALIB_AXIS_X, deviceStruct.sensors.x);
+           if(pos_dm > 0){  
                 min_power = 0;
-                distance = 0 - deviceStruct.sensors.x;
-                abs_dm_distance = X_To_dm(abs(distance));
-                motorSetPower(getPowerFromDistance(abs_dm_distance,min_power));
+                abs_dm_distance = abs(pos_dm);
+                motorSetPowerFromDistance(abs_dm_distance,min_power);
                 motorDriverOutput(MOTOR_X_RIGHT);
            }else{ 
                motorDriverOutput(MOTOR_X_SHORT);
@@ -432,11 +1014,11 @@ void motorServiceModeManagement(void){
            break;
 
            case 6: // Move Z up to 100
-               if(deviceStruct.sensors.z < Zdm_To_Units(1000)){  
+               pos_dm = calibPosition(CALIB_AXIS_Z, deviceStruct.sensors.z);
+               if(pos_dm < 1000){  
                    min_power = 0;
-                   distance = Zdm_To_Units(1000) - deviceStruct.sensors.z;
-                   abs_dm_distance = Z_To_dm(abs(distance));
-                   motorSetPower(getPowerFromDistance(abs_dm_distance,min_power));
+                   abs_dm_distance = abs(1000 - pos_dm);
+                   motorSetPowerFromDistance(abs_dm_distance,min_power);
                    motorDriverOutput(MOTOR_Z_UP);
                    motorDriverOutput(MOTOR_Z_DOWN);
                }else{ 
@@ -464,6 +1046,142 @@ void motorServiceModeManagement(void){
  
 }
 
+/**
+ * \ingroup MOTMOD
+ * This function returns the Key Step jog key pressed.
+ * 
+ * The keys are tested with the priority of the calibration mode.
+ * 
+ * @return (axis << 1) | direction (1 = toward the max position) or MOTOR_KEYSTEP_NO_KEY
+ */
+static int motorKeyStepKey(void){
+    if(deviceStruct.keyboard.hw.zm) return (CALIB_AXIS_Z << 1);
+    if(deviceStruct.keyboard.hw.zp) return (CALIB_AXIS_Z << 1) | 1;
+    if(deviceStruct.keyboard.hw.ym) return (CALIB_AXIS_Y << 1);
+    if(deviceStruct.keyboard.hw.yp) return (CALIB_AXIS_Y << 1) | 1;
+    if(deviceStruct.keyboard.hw.xm) return (CALIB_AXIS_X << 1);
+    if(deviceStruct.keyboard.hw.xp) return (CALIB_AXIS_X << 1) | 1;
+    return MOTOR_KEYSTEP_NO_KEY;
+}
+
+/**
+ * \ingroup MOTMOD
+ * This function resets the Key Step jog for a new key status.
+ * 
+ * @param key the key pressed (see motorKeyStepKey())
+ */
+static void motorKeyStepReset(int key){
+    motorStruct.keystep.key = key;
+    motorStruct.keystep.hold_timer = 0;
+    motorStruct.keystep.steps = 0;
+    motorStruct.keystep.stage = 0;
+    motorStruct.keystep.count = 0;
+    motorStruct.keystep.wait_release = false;
+}
+
+/**
+ * \ingroup MOTMOD
+ * This function activates a Key Step jog motion.
+ * 
+ * + A step moves the axis of the key by the step distance from the current position
+ * (within the axis limits), without the key requested: the position is held for
+ * MOTOR_KEYSTEP_HOLD_TIME only, so the next step can follow;
+ * + The continuous motion (step = 0) moves the axis to the limit of the key direction
+ * with the key requested: it stops on the key release.
+ * 
+ * @param key the key pressed (see motorKeyStepKey())
+ * @param step the step distance (0.1mm) or 0 for the continuous motion
+ * @return true if the activation started
+ */
+static bool motorKeyStepMove(int key, int step){
+    CALIB_AXIS_t ax = (CALIB_AXIS_t) (key >> 1);
+    bool plus = (key & 1);
+    int target;
+    MOTOR_COMMAND_RESULTS_t result;
+    
+    if(step){
+        if(ax == CALIB_AXIS_X) GetX();
+        else if(ax == CALIB_AXIS_Y) GetY();
+        else GetZ();
+        
+        target = (plus) ? deviceStruct.pointer.pos + step : deviceStruct.pointer.pos - step;
+        if(target < 0) target = 0;
+        if(target > calibStruct.axis[ax].max_dm) target = calibStruct.axis[ax].max_dm;
+    }else{
+        target = (plus) ? calibStruct.axis[ax].max_dm : 0;
+    }
+    
+    if(ax == CALIB_AXIS_X) result = motorMoveX(target, false, (step == 0));
+    else if(ax == CALIB_AXIS_Y) result = motorMoveY(target, false, (step == 0));
+    else result = motorMoveZ(target, false, (step == 0));
+    if(result != MOTOR_COMMAND_EXECUTING) return false;
+    
+    if(step){
+        motorStruct.command_mode.keystep = true;
+        motorStruct.command_mode.termination_timer = MOTOR_KEYSTEP_HOLD_TIME;
+    }
+    return true;
+}
+
+/**
+ * \ingroup MOTMOD
+ * This is the Key Step mode management (COMMAND_MODE with the key step enabled).
+ * 
+ * The function is called every 7.8ms, also during the activations,
+ * so the key hold time is counted during the jog motion:
+ * + a key press executes a single step (Key Step register, D0);
+ * + holding the key for the repeat delay (D1), a new step is executed 
+ * as soon as the previous one terminates: the step is doubled every D2 steps,
+ * so the axis accelerates (the power level follows the step distance, see \ref CALIBMOD);
+ * + when the step exceeds the max step (D3) the axis moves continuously 
+ * to the limit and it stops on the key release (see motorKeyReleased()).
+ * 
+ * A key pressed during a protocol command aborts the command (MOTOR_ERROR_KEY_PRESSED)
+ * and it is ignored until released, as well as a key whose motion is rejected
+ * (for example at the axis limit).
+ */
+static void motorKeyStepModeManagement(void){
+    int key = motorKeyStepKey();
+    int step;
+    
+    // Key pressed, released or changed: restarts the jog
+    if(key != motorStruct.keystep.key){
+        motorKeyStepReset(key);
+        if((key != MOTOR_KEYSTEP_NO_KEY) && (motorStruct.command_mode.command != MOTOR_COMMAND_NO_COMMAND) && (!motorStruct.command_mode.keystep)){
+            motorStruct.keystep.wait_release = true;
+        }
+    }
+    if((key == MOTOR_KEYSTEP_NO_KEY) || (motorStruct.keystep.wait_release)) return;
+    
+    if(motorStruct.keystep.hold_timer < calibStruct.keystep_delay) motorStruct.keystep.hold_timer++;
+    
+    // Waits for the previous step termination
+    if(motorStruct.command_mode.command != MOTOR_COMMAND_NO_COMMAND) return;
+    
+    // The single step of the key press, then the repeated steps after the delay
+    if((motorStruct.keystep.steps) && (motorStruct.keystep.hold_timer < calibStruct.keystep_delay)) return;
+    
+    step = calibStruct.keystep_step << motorStruct.keystep.stage;
+    if(step > calibStruct.keystep_max){
+        motorKeyStepMove(key, 0);
+        motorStruct.keystep.wait_release = true;
+        return;
+    }
+    
+    if(!motorKeyStepMove(key, step)){
+        motorStruct.keystep.wait_release = true;
+        return;
+    }
+    
+    // Ramp: the step doubles every stage of repeated steps
+    if(motorStruct.keystep.steps++){
+        if(++motorStruct.keystep.count >= calibStruct.keystep_stage){
+            motorStruct.keystep.count = 0;
+            motorStruct.keystep.stage++;
+        }
+    }
+}
+
 /**
  * This is the Main Workflow management routine.
  * 
@@ -476,13 +1194,22 @@ void motorServiceModeManagement(void){
  */
 void motorLoop(void){
 
+    // Supply sags logging
+    motorSupplySagDetection();
+    
+    // Key Step jog: handled also during its activations
+    if((motorStruct.exec_mode == COMMAND_MODE) && (deviceStruct.keyboard.flags.keystep)) motorKeyStepModeManagement();
     
     // A motor is activated: handle the activation
     if(motorStruct.command_mode.command != MOTOR_COMMAND_NO_COMMAND){
         motorActivationHandler();
         return;
     }
-      
+    
+#ifndef _MOTOR_PWM_ENABLED_
+    // The Key Step flag changed without a mode change: the interlock follows it
+    if(motorStruct.interlock.keys != motorInterlockKeys(motorStruct.exec_mode)) motorInterlockConfig(motorStruct.exec_mode);
+#endif
     
     // Handles the execution mode
     switch(motorStruct.exec_mode){
@@ -495,6 +1222,7 @@ void motorLoop(void){
     if(change_mode_request){
         change_mode_request = false;
         StatusModeRegister.mode = motorStruct.exec_mode = change_mode;
+        traceEvent(TRACE_MODE_CHANGE, (uint8_t) change_mode, 0, 0, 0);
         
         motorStruct.service_mode.sequence = 0;
         motorStruct.service_mode.command = 0;
@@ -533,11 +1261,11 @@ void motorLoop(void){
             
             motorStruct.key_timer = 0;
         }
+        
+        // Configures the CCL interlock for the new mode
+        motorInterlockConfig(motorStruct.exec_mode);
     }
     
-    // Gets the current outputs and update the motor stat
-    StatusModeRegister.power_sw_status = deviceStruct.power_sw_stat = uc_MOTOR_ENA_FEEDBACK_Get();
-    
 }
 
 
@@ -555,6 +1283,9 @@ void motorInit(void){
     StatusModeRegister.mode = motorStruct.exec_mode;
     
     // Disables the driver and set low the motor power
+#ifdef _MOTOR_PWM_ENABLED_
+    motorPwmInit();
+#endif
     motorDriverOutput(MOTORS_DISABLED);
     motorSetPower(0);
     
@@ -565,6 +1296,9 @@ void motorInit(void){
     motorStruct.command_mode.command = 0;
     motorStruct.command_mode.sequence = 0;    
     motorStruct.command_mode.abort_request = false;
+    motorKeyStepReset(MOTOR_KEYSTEP_NO_KEY);
+    motorStopChainDisarm();
+    motorInterlockConfig(motorStruct.exec_mode);
 }
 
 /**
@@ -674,6 +1408,8 @@ MOTOR_COMMAND_RESULTS_t  motorMoveX(int tXdm, bool protocol, bool key_request){
     if((protocol) && (motorStruct.exec_mode != COMMAND_MODE)) return MOTOR_ERROR_INVALID_MODE; 
     if(deviceStruct.power_sw_stat == false) return MOTOR_ERROR_DISABLE_CONDITION;
     if(motorStruct.command_mode.command != MOTOR_COMMAND_NO_COMMAND) return MOTOR_ERROR_BUSY;
+    
+    if((tXdm < 0) || (tXdm > calibStruct.axis[CALIB_AXIS_X].max_dm)) return MOTOR_ERROR_INVALID_POSITION;
 
    // Upgrade the position and checks if already in position
     GetX();
@@ -688,14 +1424,26 @@ MOTOR_COMMAND_RESULTS_t  motorMoveX(int tXdm, bool protocol, bool key_request){
     motorStruct.command_mode.key_requested = key_request;
     motorStruct.command_mode.abort_request = false;
     motorStruct.command_mode.activation_timer = 0;
+    motorStruct.command_mode.overcurrent = false;
+    motorStruct.command_mode.target_reached = false;
+    motorStruct.command_mode.key_released = false;
+    motorStruct.command_mode.keystep = false;
+    motorStruct.command_mode.power_dropped = false;
     motorStruct.command_mode.min_power = 0;
     motorStruct.command_mode.termination_fase = false;
     motorStruct.command_mode.termination_timer = MOTOR_HOLD_TIME;
     motorStruct.command_mode.termination_success = false;
+    motorStruct.command_mode.termination_error = 0;
   
     
     // 1dm every 7ms + 350ms
-    motorStruct.command_mode.activation_timeout = MOTOR_X_TIMEOUT;
+    motorStruct.command_mode.activation_timeout = calibStruct.axis[CALIB_AXIS_X].timeout;
+    
+    // Arms the target band interrupt (position window) and the hardware stop chain
+    PositionWindowStart(CALIB_AXIS_X, tXdm);
+    motorStopChainArm();
+    
+    traceEvent(TRACE_CMD_START, MOTOR_COMMAND_X, (protocol ? 1:0) | (key_request ? 2:0), (uint8_t) (tXdm & 0xff), (uint8_t) ((tXdm >> 8) & 0xff));
     return MOTOR_COMMAND_EXECUTING;
 }
 
@@ -706,6 +1454,8 @@ MOTOR_COMMAND_RESULTS_t  motorMoveY(int tYdm, bool protocol, bool key_request){
     if(deviceStruct.power_sw_stat == false) return MOTOR_ERROR_DISABLE_CONDITION;
     if(motorStruct.command_mode.command != MOTOR_COMMAND_NO_COMMAND) return MOTOR_ERROR_BUSY;
     
+    if((tYdm < 0) || (tYdm > calibStruct.axis[CALIB_AXIS_Y].max_dm)) return MOTOR_ERROR_INVALID_POSITION;
+    
     // Upgrade the position and checks if already in position
     GetY();    
     int distance = abs(deviceStruct.pointer.ydm - tYdm);
@@ -719,14 +1469,26 @@ MOTOR_COMMAND_RESULTS_t  motorMoveY(int tYdm, bool protocol, bool key_request){
     motorStruct.command_mode.key_requested = key_request;
     motorStruct.command_mode.abort_request = false;
     motorStruct.command_mode.activation_timer = 0;
+    motorStruct.command_mode.overcurrent = false;
+    motorStruct.command_mode.target_reached = false;
+    motorStruct.command_mode.key_released = false;
+    motorStruct.command_mode.keystep = false;
+    motorStruct.command_mode.power_dropped = false;
     motorStruct.command_mode.min_power = 0;
     motorStruct.command_mode.termination_fase = false;
     motorStruct.command_mode.termination_timer = MOTOR_HOLD_TIME;
     motorStruct.command_mode.termination_success = false;
+    motorStruct.command_mode.termination_error = 0;
    
    
     // 1dm every 7ms + 350ms
-    motorStruct.command_mode.activation_timeout = MOTOR_Y_TIMEOUT;
+    motorStruct.command_mode.activation_timeout = calibStruct.axis[CALIB_AXIS_Y].timeout;
+    
+    // Arms the target band interrupt (position window) and the hardware stop chain
+    PositionWindowStart(CALIB_AXIS_Y, tYdm);
+    motorStopChainArm();
+    
+    traceEvent(TRACE_CMD_START, MOTOR_COMMAND_Y, (protocol ? 1:0) | (key_request ? 2:0), (uint8_t) (tYdm & 0xff), (uint8_t) ((tYdm >> 8) & 0xff));
     return MOTOR_COMMAND_EXECUTING;
 }
 
@@ -736,7 +1498,7 @@ MOTOR_COMMAND_RESULTS_t  motorMoveZ(int tZdm, bool protocol, bool key_request){
     if(deviceStruct.power_sw_stat == false) return MOTOR_ERROR_DISABLE_CONDITION;
     if(motorStruct.command_mode.command != MOTOR_COMMAND_NO_COMMAND) return MOTOR_ERROR_BUSY;
     
-    if(tZdm > MAX_Z_POSITION_dm) return MOTOR_ERROR_INVALID_POSITION;
+    if((tZdm < 0) || (tZdm > calibStruct.axis[CALIB_AXIS_Z].max_dm)) return MOTOR_ERROR_INVALID_POSITION;
 
     // Upgrade the position and checks if already in position
     GetZ();
@@ -751,14 +1513,26 @@ MOTOR_COMMAND_RESULTS_t  motorMoveZ(int tZdm, bool protocol, bool key_request){
     motorStruct.command_mode.key_requested = key_request;
     motorStruct.command_mode.abort_request = false;
     motorStruct.command_mode.activation_timer = 0;
+    motorStruct.command_mode.overcurrent = false;
+    motorStruct.command_mode.target_reached = false;
+    motorStruct.command_mode.key_released = false;
+    motorStruct.command_mode.keystep = false;
+    motorStruct.command_mode.power_dropped = false;
     motorStruct.command_mode.min_power = 0;
     motorStruct.command_mode.termination_fase = false;
     motorStruct.command_mode.termination_timer = MOTOR_HOLD_TIME;
     motorStruct.command_mode.termination_success = false;
+    motorStruct.command_mode.termination_error = 0;
     
     
     // 1dm every 7ms + 350ms
-    motorStruct.command_mode.activation_timeout = MOTOR_Z_TIMEOUT;
+    motorStruct.command_mode.activation_timeout = calibStruct.axis[CALIB_AXIS_Z].timeout;
+    
+    // Arms the target band interrupt (position window) and the hardware stop chain
+    PositionWindowStart(CALIB_AXIS_Z, tZdm);
+    motorStopChainArm();
+    
+    traceEvent(TRACE_CMD_START, MOTOR_COMMAND_Z, (protocol ? 1:0) | (key_request ? 2:0), (uint8_t) (tZdm & 0xff), (uint8_t) ((tZdm >> 8) & 0xff));
     return MOTOR_COMMAND_EXECUTING;
 }
 
@@ -770,15 +1544,23 @@ void motorAbort(void){
 bool  motorEnableKeyStepMode(unsigned char par){
     if(par == 0) {
         SetKeyMode(false,false);
+        motorInterlockConfig(motorStruct.exec_mode);
         return true;
     }
     
     if(motorStruct.exec_mode != COMMAND_MODE) return false;
     SetKeyMode(true,true);
+    motorInterlockConfig(motorStruct.exec_mode);
+    motorKeyStepReset(MOTOR_KEYSTEP_NO_KEY);
     return true;
 }
 
 static void MotorCommandPositionHold(void){
+    PositionWindowStop();
+    motorStopChainDisarm();
+    
+    traceEvent(TRACE_CMD_HOLD, (uint8_t) motorStruct.command_mode.command, motorStruct.command_mode.termination_error, (uint8_t) (deviceStruct.pointer.pos & 0xff), (uint8_t) ((deviceStruct.pointer.pos >> 8) & 0xff));
+    
     if(motorStruct.command_mode.command == MOTOR_COMMAND_X){                
         motorDriverOutput(MOTOR_X_SHORT);
     }else if(motorStruct.command_mode.command == MOTOR_COMMAND_Y){
@@ -788,10 +1570,20 @@ static void MotorCommandPositionHold(void){
     }
     return;
 }
-#define BLANK_OBSTACLE_INITIAL_TIME 50
-#define OBSTACLE_DELAY_TIME_TEST 15
-#define OBSTACLE_DELTA_POSITION 2
-void motorActivationHandler(void){
+/**
+ * \ingroup MOTMOD
+ * This function completes an activation with the target reached.
+ */
+static void MotorCommandTargetReached(void){
+    MotorCommandPositionHold();
+    
+    motorStruct.command_mode.termination_fase = true;   
+    motorStruct.command_mode.termination_success = true;
+    BuzzerSet(1,10,10);
+    return;
+}
+
+void HOT_CODE motorActivationHandler(void){
         
         int distance;        
         static int delay_timer = 0;
@@ -813,6 +1605,9 @@ void motorActivationHandler(void){
                     motorDriverOutput(MOTORS_DISABLED);
                     
                     // Command termination here
+                    traceEvent(TRACE_CMD_STOP, (uint8_t) motorStruct.command_mode.command, 
+                            (motorStruct.command_mode.termination_success) ? 0 : motorStruct.command_mode.termination_error, 
+                            (uint8_t) (deviceStruct.pointer.pos & 0xff), (uint8_t) ((deviceStruct.pointer.pos >> 8) & 0xff));
                     motorStruct.command_mode.termination_fase = false;
                     motorStruct.command_mode.command = MOTOR_COMMAND_NO_COMMAND; 
                     
@@ -832,16 +1627,20 @@ void motorActivationHandler(void){
             return;
         }
         
-        // Sets the current positions data
+        // Sets the current positions data: the RTC triggered sample of the tick
+        // (a conversion only if the sample is not available)
         if(motorStruct.command_mode.command == MOTOR_COMMAND_X){
-            GetX();                      
+            if(!PositionSampleGet(CALIB_AXIS_X)) GetX();                      
         }else if(motorStruct.command_mode.command == MOTOR_COMMAND_Y){
-            GetY();                                 
+            if(!PositionSampleGet(CALIB_AXIS_Y)) GetY();                                 
         }else{
-            GetZ();            
+            if(!PositionSampleGet(CALIB_AXIS_Z)) GetZ();            
         }     
         distance = motorStruct.command_mode.target - deviceStruct.pointer.pos;
         
+        // Samples the position and the power applied in the previous tick
+        traceEvent(TRACE_SAMPLE, (uint8_t) (deviceStruct.pointer.pos & 0xff), (uint8_t) ((deviceStruct.pointer.pos >> 8) & 0xff), motorStruct.power_percent, (uint8_t) motorStruct.mode);
+        
         
         motorStruct.command_mode.activation_timer++;
         delay_timer++;
@@ -853,32 +1652,61 @@ void motorActivationHandler(void){
             motorStruct.command_mode.termination_success = false;
             motorStruct.command_mode.termination_error = MET_CAN_COMMAND_ABORT_CODE;
             //if(motorStruct.command_mode.protocol_activation) MET_Can_Protocol_returnCommandAborted();
-            BuzzerSet(5,5,5);
+            BuzzerSetPriority(5,5,5,BUZZER_PRIORITY_ALARM);
+            MotorCommandPositionHold();
+            return;
+        }
+        
+        // Power switch dropped during the activation (the motor is already braked)
+        if(motorStruct.command_mode.power_dropped){
+            motorStruct.command_mode.termination_fase = true;
+            motorStruct.command_mode.termination_success = false;
+            motorStruct.command_mode.termination_error = MOTOR_ERROR_POWER_SWITCH;
+            
+            BuzzerSetPriority(4,5,5,BUZZER_PRIORITY_ALARM);
+            MotorCommandPositionHold();
+            return;
+        }
+        
+        // Target band reached by the position window (the motor is already braked)
+        if(motorStruct.command_mode.target_reached){
+            MotorCommandTargetReached();
+            return;
+        }
+        
+        // Over-current detected by the motor supply conversion (the motor is already braked)
+        if(motorStruct.command_mode.overcurrent){
+            motorStruct.command_mode.termination_fase = true;
+            motorStruct.command_mode.termination_success = false;
+            motorStruct.command_mode.termination_error = MOTOR_ERROR_OVERCURRENT;
+            if(StatusMonitorRegister.OVERCURRENT < 255) StatusMonitorRegister.OVERCURRENT++;
+            
+            BuzzerSetPriority(3,5,5,BUZZER_PRIORITY_ALARM);
             MotorCommandPositionHold();
             return;
         }
             
         // Checks if the button is pressed (if required))
         if(motorStruct.command_mode.key_requested){
-            if(!deviceStruct.keyboard.flags.key_present){ 
+            if((!deviceStruct.keyboard.flags.key_present) || (motorStruct.command_mode.key_released)){ 
                 motorStruct.command_mode.termination_fase = true;
                 motorStruct.command_mode.termination_success = false;
                 motorStruct.command_mode.termination_error = MOTOR_ERROR_KEY_RELEASED;
                 
-                BuzzerSet(2,5,5);
+                BuzzerSetPriority(2,5,5,BUZZER_PRIORITY_ALARM);
                 MotorCommandPositionHold();
                 return;
             }
         }
         
-         // Checks if the button is not pressed (if the button is not required)
-        if(!motorStruct.command_mode.key_requested){
+         // Checks if the button is not pressed (if the button is not required, the key step jog excluded)
+        if((!motorStruct.command_mode.key_requested) && (!motorStruct.command_mode.keystep)){
             if(deviceStruct.keyboard.flags.key_present){ 
                 motorStruct.command_mode.termination_fase = true;
                 motorStruct.command_mode.termination_success = false;
                 motorStruct.command_mode.termination_error = MOTOR_ERROR_KEY_PRESSED;
                 
-                BuzzerSet(2,5,5);
+                BuzzerSetPriority(2,5,5,BUZZER_PRIORITY_ALARM);
                 MotorCommandPositionHold();
                 return;
             }
@@ -886,9 +1714,9 @@ void motorActivationHandler(void){
     
         // Test for the obstacle detection
         // The obstacle is not tested in the initial fase of the activation
-        if(motorStruct.command_mode.activation_timer > BLANK_OBSTACLE_INITIAL_TIME){
-            if(delay_timer > OBSTACLE_DELAY_TIME_TEST){
-                if(abs(deviceStruct.pointer.pos-obstacle_position) > OBSTACLE_DELTA_POSITION){
+        if(motorStruct.command_mode.activation_timer > calibStruct.obstacle_blank){
+            if(delay_timer > calibStruct.obstacle_delay){
+                if(abs(deviceStruct.pointer.pos-obstacle_position) > calibStruct.obstacle_delta){
                     // OK
                     delay_timer = 0;
                     obstacle_position = deviceStruct.pointer.pos;                    
@@ -898,7 +1726,7 @@ void motorActivationHandler(void){
                     motorStruct.command_mode.termination_success = false;
                     motorStruct.command_mode.termination_error = MOTOR_ERROR_OBSTACLE;
                     
-                    BuzzerSet(3,5,5);
+                    BuzzerSetPriority(3,5,5,BUZZER_PRIORITY_ALARM);
                     MotorCommandPositionHold();
                     return;
                 }
@@ -914,29 +1742,18 @@ void motorActivationHandler(void){
            motorStruct.command_mode.termination_success = false;
            motorStruct.command_mode.termination_error = MOTOR_ERROR_TIMEOUT;
            
-           BuzzerSet(4,5,5);
+           BuzzerSetPriority(4,5,5,BUZZER_PRIORITY_ALARM);
            MotorCommandPositionHold();
            return;
         }
 
         
         // Sets the power based on the distance
-        motorSetPower(getPowerFromDistance(abs(distance),motorStruct.command_mode.min_power));        
+        motorSetPowerFromDistance(abs(distance),motorStruct.command_mode.min_power);        
         
-        // Verifies the target
+        // Verifies the target (software supervision of the position window)
         if(abs(distance) < 2 ){
-         
-            MotorCommandPositionHold();
-            
-            motorStruct.command_mode.termination_fase = true;   
-            motorStruct.command_mode.termination_success = true;
-            /*
-            if(motorStruct.command_mode.protocol_activation){
-                unsigned char L = (unsigned char) (deviceStruct.pointer.pos & 0xff);
-                unsigned char H = (unsigned char) ((deviceStruct.pointer.pos >>8) & 0xff);
-                MET_Can_Protocol_returnCommandExecuted(L,H);                
-            }*/
-            BuzzerSet(1,10,10);
+            MotorCommandTargetReached();
             return;
                       
         }else if(distance < 0){
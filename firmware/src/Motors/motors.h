@@ -43,6 +43,187 @@
   * + motorMoveY() : move the Y axe to a position;
   * + motorMoveZ() : move the Z axe to a position;
   * + motorAbort() : aborts a pending command;
+  * + motorSetPowerPercent() : sets the motor power (0 to 100%);
+  * 
+  * ## Motor Power Control
+  * 
+  * The motor power is normally selected with the VSEL0..2 outputs,
+  * setting one of the 8 supply voltage levels of the driver (38% to 100% of 24V).
+  * During the activation the level is selected by the distance from the target
+  * with the calibration power table (see \ref CALIBMOD).
+  * 
+  * With the _MOTOR_PWM_ENABLED_ option (see application.h) the supply is set 
+  * to the maximum level and the power is modulated with the duty cycle 
+  * of a 20kHz PWM (TCC0/WO[0]) on the driver MOT_STOP input:
+  * + during the activation the driver alternates the drive and the brake (slow decay),
+  * so the average motor voltage is proportional to the duty cycle;
+  * + the power is continuous from 0 to 100% and it is interpolated 
+  * between the voltages of the calibration power table levels;
+  * + in the short and disabled modes the MOT_STOP pin is returned to the GPIO (low).
+  * 
+  * ### Supply Compensation
+  * 
+  * The motor supply is measured every 7.8ms (AIN9, see main.c) before the motor loop.
+  * The power commands are percentages of the nominal 24V supply:
+  * they are scaled with the ratio between the nominal and the measured supply,
+  * so the motor speed does not change when the supply sags 
+  * (the activation time and the obstacle detection are not affected).
+  * Without the PWM the nearest VSEL level is selected.
+  * 
+  * The supply sags (less than 21.6V with the driver enabled) are recorded 
+  * in the event trace (TRACE_SUPPLY_SAG) with the minimum supply and the duration.
+  * 
+  * ### Target Band Interrupt
+  * 
+  * When an activation starts, the position channel of the axis is converted 
+  * in free running mode (a conversion every 7us) with the ADC0 window comparator
+  * set to the target band (see PositionWindowStart() in main.c).
+  * The WINMON interrupt brakes the motor (short mode) as soon as a conversion 
+  * falls into the band, without waiting for the 7.8ms activation tick:
+  * the activation handler then completes the command. 
+  * The handler keeps the software supervision (target, direction, obstacle, timeout).
+  * 
+  * The other ADC0 channels suspend the free running conversion
+  * for the time of their conversion.
+  * The driver outputs are set with the interrupts disabled, and a stop of the 
+  * interrupt handlers is never overridden by the activation handler.
+  * 
+  * ### Over-current Detection
+  * 
+  * The board has not a motor current sense input: a stalled motor is detected
+  * by the drop of the motor supply monitor (ANL_MONITOR_VM) caused by the over-current.
+  * During the motion of a command activation (after the obstacle blank time)
+  * the ADC1 window comparator is armed on the motor supply conversion
+  * (threshold: 75% of the filtered supply, see motorOverCurrentThreshold()).
+  * The WINMON interrupt brakes the motor at the end of the conversion,
+  * without waiting for the position based obstacle detection,
+  * and the command terminates with the MOTOR_ERROR_OVERCURRENT error code.
+  * 
+  * ### Keys Release
+  * 
+  * The keyboard buttons are handled by the EIC interrupts (debounced in hardware, about 7ms):
+  * when all the keys are released during a key requested activation (calibration mode, key step continuous motion),
+  * the interrupt brakes the motor immediately (short mode, see motorKeyReleased())
+  * and the activation handler terminates the command with the MOTOR_ERROR_KEY_RELEASED code.
+  * The motor keeps driving after the release for the debounce time only
+  * (it was up to 135ms with the 128ms keyboard polling).
+  * 
+  * ### Power Switch Drop
+  * 
+  * The motor power switch feedback (MOTOR_ENA_FEEDBACK) is monitored by the EIC interrupt
+  * (see SafetyFeedbackInit() in main.c): deviceStruct.power_sw_stat follows every edge.
+  * A drop during an activation brakes the motor immediately (see motorPowerSwitchDropped())
+  * and the command terminates with the MOTOR_ERROR_POWER_SWITCH error code
+  * (before, the feedback was read only at the end of the motor loop and the drop was not detected 
+  * by the activation: the motor stopped by obstacle or timeout).
+  * 
+  * ### Abort Fast Path
+  * 
+  * An ABORT command frame is detected by the CAN reception interrupt
+  * (see MET_Can_Protocol_SetAbortHandler()): the motor is braked immediately 
+  * (see motorAbortFast()) and the activation handler terminates the command 
+  * at the next tick with the abort code, while the frame is answered as usual by the main loop.
+  * Before, the abort was executed only after the main loop processed the frame
+  * and the next 7.8ms tick (8ms plus the main loop blocking time).
+  * The worst latencies (frame to brake and frame to answer) are reported
+  * in the ABORT LATENCY STATUS register (see the \ref CANPROT module).
+  * 
+  * ### Key Step Mode
+  * 
+  * In COMMAND_MODE with the key step enabled (\ref CMD_ENABLE_KEYSTEP)
+  * the keyboard jogs the axes without the remote host
+  * (X+, Y+, Z+ toward the max position, X-, Y-, Z- toward 0):
+  * + a key tap moves the axis by a single step (Key Step PARAMETER register, default 0.2mm);
+  * + holding the key for the repeat delay (default 312ms), the steps are repeated 
+  * and the step is doubled every stage (default 2 steps): 
+  * the speed increases with the power level of the step distance;
+  * + when the step exceeds the max step (default 10mm) the axis moves continuously
+  * to the limit, with the key requested: the release stops the motor (see Keys Release).
+  * 
+  * The steps are ordinary activations (target band, obstacle, timeout) 
+  * with a short position hold (62ms), not reported to the remote host.
+  * 
+  * ### Hardware Stop Chain
+  * 
+  * The WINMON events of both the ADC0 (target band) and the ADC1 (over-current)
+  * are routed by the EVSYS (asynchronous channels 0 and 1, see EVSYS_Initialize())
+  * to the PORT event inputs 0 and 1, whose event action clears the MOT_STOP pin (PA08).
+  * The chain is armed for every command activation (motorStopChainArm())
+  * and it is disarmed when the position is held (motorStopChainDisarm()):
+  * the motor is stopped by the hardware without any CPU involvement,
+  * and the WINMON interrupt handlers then update the activation status.
+  * 
+  * Estimated stop latency from the end of the conversion in the window:
+  * 
+  * |PATH|LATENCY|NOTE|
+  * |:--|:--|:--|
+  * |Hardware chain|< 100ns|asynchronous event path plus the PORT event action|
+  * |WINMON interrupt|~0.3us + masking|12 cycles of exception entry plus the handler|
+  * |Activation handler|up to 7.8ms|software check of the converted position|
+  * 
+  * The interrupt path can be further delayed by the higher priority interrupts
+  * and by the critical sections (driver outputs update): the hardware chain is not.
+  * 
+  * The estimates are not verified on the target. With the _PROFILER_ENABLED_ option 
+  * the first two paths are measured by motorStopLatencyTest(), with the driver disabled,
+  * from the EVSYS software event or the pending interrupt to the MOT_STOP low readback:
+  * + PROFILE_STOP_HW_TEST: hardware chain;
+  * + PROFILE_STOP_SW_TEST: WINMON interrupt (exception entry plus the handler brake);
+  * + PROFILE_STOP_ISR: handler execution of the real stops (without the exception entry).
+  * 
+  * \note With the _MOTOR_PWM_ENABLED_ option MOT_STOP is driven by the TCC0
+  * (the PORT output register has no effect): the chain is not armed
+  * and the motor is stopped by the interrupt handlers only.
+  * 
+  * ### CCL Interlock
+  * 
+  * The CCL (configurable custom logic) adds to the stop chain the enable inputs of the manual motion:
+  * + LUT1 input: EIC event of the MOTOR_ENA_FEEDBACK line (EVSYS channel 4);
+  * + LUT0 inputs: EIC event of the button of the activation (EVSYS channel 3) and the LUT1 output;
+  * + LUT0 output (OR): EVSYS channel 5 to the PORT event input 2, that clears the MOT_STOP pin.
+  * 
+  * The key release, the keyboard enable drop (the buttons are supplied by the BUTTON_ENA switch) 
+  * and the power switch drop stop the motor in gate delays from the edge detected by the EIC 
+  * (after the debouncer for the buttons), independently of the interrupt latency 
+  * and of the main loop timing: the interrupt handlers then terminate the activation
+  * (see motorKeyReleased() and motorPowerSwitchDropped()).
+  * 
+  * The interlock is configured for the working mode by motorInterlockConfig():
+  * + CALIB_MODE: power switch and the button of every activation;
+  * + COMMAND_MODE: power switch; with the Key Step enabled, also the button of the continuous jog;
+  * + DISABLE_MODE, SERVICE_MODE: the CCL is disabled.
+  * 
+  * It is armed with the stop chain (motorStopChainArm()), only while the activation 
+  * drives the motor (DRIVER_ENA set), and it is disarmed at the position hold.
+  * The button input is armed only when a single button is pressed (see KeyboardEventGenerator()):
+  * the release of that button stops the motor even if another button is still pressed.
+  * The state is reported in the STATUS MODE register (bytes 1.4 to 1.6).
+  * 
+  * \note The pins of the enable chain cannot be routed directly to the CCL:
+  * PA16..PA18 (CCL IN0..IN2) and PA10 (CCL IN5) are used by the EIC, 
+  * BUTTON_ENA (PA21) has no CCL function and DRIVER_ENA (PB15, CCL IN10) is an output.
+  * The inputs are then the EIC events; the interlock is not armed with the _MOTOR_PWM_ENABLED_ option.
+  * 
+  * ### Position Sampling
+  * 
+  * The position channels are converted by the ADC0 at the RTC period,
+  * started in hardware by the RTC PER0 event (7.8125ms) through the EVSYS:
+  * the sample time does not depend on the main loop activity (CAN, ADC1 conversions).
+  * Every sample is stored with its time (RTC counter at the period boundary, 1/1024s units).
+  * 
+  * + Without activation, the X, Y and Z channels are sampled in round robin 
+  * (every axis every 23.4ms);
+  * + During an activation (position window armed) the moving axis is sampled
+  * from the free running conversion at every RTC period (RTC interrupt);
+  * 
+  * The activation handler consumes one sample of the moving axis every tick
+  * (PositionSampleGet()), so the position deltas used by the obstacle detection
+  * refer to the fixed sampling period. The time of the last position is available 
+  * in deviceStruct.pointer.time.
+  * A single conversion (GetX(), GetY(), GetZ()) is executed only if the sample is not available.
+  * 
+  * \note The VSEL pins (PB12..PB14) cannot be driven by the DAC (PA02, PA05):
+  * the analog control of the supply is not available on this board.
   */
 
 /// \ingroup MOTMOD
@@ -106,6 +287,44 @@ ext bool  motorEnableKeyStepMode(unsigned char par);
 /// aborts a pending command
 ext void motorAbort(void);
 
+/// \ingroup MOTMOD
+/// sets the motor power (0 to 100%)
+ext void motorSetPowerPercent(unsigned char percent);
+
+/// \ingroup MOTMOD
+/// returns the over-current threshold of the motor supply conversion (0 = not armed)
+ext uint16_t motorOverCurrentThreshold(void);
+
+/// \ingroup MOTMOD
+/// stops a key requested activation at the keys release (keyboard interrupt)
+ext void motorKeyReleased(void);
+
+/// \ingroup MOTMOD
+/// ABORT fast path: brakes the activation from the CAN reception interrupt
+ext void motorAbortFast(void);
+
+/// \ingroup MOTMOD
+/// stops the activation at the drop of the motor power switch (safety feedback interrupt)
+ext void motorPowerSwitchDropped(void);
+
+/// \ingroup MOTMOD
+/// arms the hardware stop chain (ADC WINMON events to MOT_STOP)
+ext void motorStopChainArm(void);
+
+/// \ingroup MOTMOD
+/// disarms the hardware stop chain
+ext void motorStopChainDisarm(void);
+
+/// \ingroup MOTMOD
+/// configures the CCL interlock for a working mode
+ext void motorInterlockConfig(int mode);
+
+#ifdef _PROFILER_ENABLED_
+/// \ingroup MOTMOD
+/// measures the stop latency of the hardware chain and of the WINMON interrupt (profiler probes)
+ext bool motorStopLatencyTest(void);
+#endif
+
 /// \ingroup MOTMOD
 /// Table of the driver activation mode
 typedef enum{
@@ -144,6 +363,7 @@ typedef enum{
 typedef struct{    
     MOTOR_MODE_t mode; //!< Current status of the motor driver mode
     unsigned power;//!< Current motor voltage level    
+    unsigned char power_percent;//!< Current motor power command (% of the nominal 24V)
     int exec_mode;//!< Current workflow
     
     int key_timer; //!< Generic Timer to handle the keyboard chage status
@@ -163,7 +383,12 @@ typedef struct{
       
       bool protocol_activation; //!< The command is initiated by the CAN protocol
       bool key_requested;       //!< The activation requires the button pressed
-      bool abort_request;       //!< abort command request flag
+      volatile bool abort_request; //!< abort command request flag (also set by the CAN interrupt)
+      volatile bool overcurrent; //!< Over-current detected (ADC1 WINMON interrupt)
+      volatile bool target_reached; //!< Target band reached (ADC0 WINMON interrupt)
+      volatile bool key_released; //!< Keys released during a key requested activation (EIC interrupt)
+      bool keystep;             //!< Key Step jog step: the keys are not tested
+      volatile bool power_dropped; //!< Motor power switch dropped during the activation (EIC interrupt)
       int min_power;            //!< Minimum value of the power usable during the activation
       int activation_timer;     //!< Time since the command beginning
       int activation_timeout;   //!< Sets the whole activation timeout
@@ -173,6 +398,23 @@ typedef struct{
       unsigned char termination_error;//!< In case of error this is the error code
     }command_mode;
     
+    /// data structure for the key step jog (command workflow)
+    struct{
+      int key;                  //!< Key of the jog: (axis << 1) | direction, -1 = no key
+      int hold_timer;           //!< Time since the key press (saturated to the repeat delay)
+      int steps;                //!< Steps executed since the key press
+      int stage;                //!< Ramp stage: the step is the single step << stage
+      int count;                //!< Steps executed in the current stage
+      bool wait_release;        //!< No more motion until the key release
+    }keystep;
+    
+    /// data structure for the CCL interlock
+    struct{
+      bool enabled;             //!< The interlock is enabled in the current mode
+      bool keys;                //!< The button of a key requested activation is an interlock input
+      bool armed;               //!< The interlock is armed (activation in progress)
+    }interlock;
+    
 }MOTORS_t;
 
 ext MOTORS_t motorStruct; 
@@ -0,0 +1,159 @@
+#define _PROFILER_C
+
+#include "application.h"
+#include "profiler.h"
+
+#ifdef _PROFILER_ENABLED_
+
+#include <string.h>
+#include "Shared/CAN/MET_can_protocol.h"
+
+#ifndef __XC32
+#include <time.h>
+#endif
+
+#ifdef __XC32
+    #define PROFILER_IRQ_DISABLE()  bool _profiler_irq = NVIC_INT_Disable() //!< Enters the probe statistics critical section
+    #define PROFILER_IRQ_RESTORE()  NVIC_INT_Restore(_profiler_irq) //!< Leaves the probe statistics critical section
+#else
+    #define PROFILER_IRQ_DISABLE()
+    #define PROFILER_IRQ_RESTORE()
+#endif
+
+/**
+ * \addtogroup PROFMOD
+ *
+ *  @{
+ */
+
+static PROFILER_PROBE_STAT_t profilerStat[PROFILER_PROBES]; //!< Probes statistics
+static uint8_t profilerPublishIdx = 0; //!< Next probe to be published
+
+#ifndef __XC32
+/**
+ * This function returns the host monotonic time in ns.
+ *
+ * The result is truncated to 32 bit, as the target cycle counter:
+ * the difference of two samples is valid up to 4.29 s.
+ */
+uint32_t profilerHostTimestamp(void){
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint32_t) ((uint64_t) ts.tv_sec * 1000000000ULL + (uint64_t) ts.tv_nsec);
+}
+#endif
+
+/**
+ * This function initializes the profiler module.
+ *
+ * On the target the DWT cycle counter is enabled:
+ * + the trace subsystem is enabled (DEMCR.TRCENA);
+ * + the cycle counter is started (DWT_CTRL.CYCCNTENA);
+ *
+ * The counter is not cleared: it is started at the reset 
+ * and it is shared with the boot time measurement.
+ *
+ * The counter runs at the CPU clock and wraps every 35.8 s @ 120MHz:
+ * the unsigned difference of two samples is always valid for shorter intervals.
+ */
+void profilerInit(void){
+
+#ifdef __XC32
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+#endif
+
+    profilerReset();
+}
+
+/**
+ * This function clears the statistics of all the probes.
+ *
+ * The interrupts are disabled: the probes are recorded also by the interrupt handlers.
+ */
+void profilerReset(void){
+    PROFILER_IRQ_DISABLE();
+    memset(profilerStat, 0, sizeof(profilerStat));
+    for(int i=0; i< PROFILER_PROBES; i++) profilerStat[i].min = 0xFFFFFFFF;
+    PROFILER_IRQ_RESTORE();
+}
+
+/**
+ * This function adds a sample to the statistics of a probe.
+ *
+ * The histogram bin is selected with the position of the
+ * most significant bit of the sample, so no division is required.
+ *
+ * @param id probe identifier
+ * @param t sampled time in cycles (ns on host)
+ */
+void profilerRecord(PROFILER_PROBE_t id, uint32_t t){
+    if(id >= PROFILER_PROBES) return;
+    PROFILER_PROBE_STAT_t* p = &profilerStat[id];
+
+    p->count++;
+    p->sum += t;
+    if(t < p->min) p->min = t;
+    if(t > p->max) p->max = t;
+
+    int bin = 0;
+    if(t >> PROFILER_HISTO_BASE_SHIFT){
+        bin = ((31 - __builtin_clz(t)) - PROFILER_HISTO_BASE_SHIFT) / 2 + 1;
+        if(bin >= PROFILER_HISTO_BINS) bin = PROFILER_HISTO_BINS - 1;
+    }
+    if(p->histo[bin] != 0xFFFF) p->histo[bin]++;
+}
+
+/**
+ * This function returns the statistics of a probe.
+ *
+ * @param id probe identifier
+ * @return the pointer to the probe statistics or NULL if the probe doesn't exist
+ */
+const PROFILER_PROBE_STAT_t* profilerGetStat(PROFILER_PROBE_t id){
+    if(id >= PROFILER_PROBES) return NULL;
+    return &profilerStat[id];
+}
+
+/// Sets a DATA register of the profiler range with a 32 bit value
+static void profilerSetData32(uint8_t idx, uint32_t val){
+    MET_Can_Protocol_SetDataReg(idx, 0, (uint8_t) val);
+    MET_Can_Protocol_SetDataReg(idx, 1, (uint8_t) (val >> 8));
+    MET_Can_Protocol_SetDataReg(idx, 2, (uint8_t) (val >> 16));
+    MET_Can_Protocol_SetDataReg(idx, 3, (uint8_t) (val >> 24));
+}
+
+/**
+ * This function copies the statistics of a single probe
+ * into the DATA registers, rotating the probe at every call.
+ *
+ * The probe is copied with the interrupts disabled (the interrupt handlers 
+ * record probes too, see PROFILE_STOP_ISR), so the published values 
+ * belong to the same sample; the DATA registers are written from the copy.
+ *
+ * See the PROFILER DATA REGISTERS table for the register content.
+ */
+void profilerPublish(void){
+    PROFILER_PROBE_STAT_t snapshot;
+    PROFILER_PROBE_STAT_t* p = &snapshot;
+    
+    PROFILER_IRQ_DISABLE();
+    snapshot = profilerStat[profilerPublishIdx];
+    PROFILER_IRQ_RESTORE();
+    
+    uint8_t idx = PROFILER_DATA_BASE_IDX + profilerPublishIdx * PROFILER_REGISTERS_PER_PROBE;
+
+    profilerSetData32(idx++, (p->count) ? p->min : 0);
+    profilerSetData32(idx++, p->max);
+    profilerSetData32(idx++, (p->count) ? (uint32_t) (p->sum / p->count) : 0);
+    profilerSetData32(idx++, p->count);
+    for(int i=0; i < PROFILER_HISTO_BINS; i+=2){
+        profilerSetData32(idx++, (uint32_t) p->histo[i] | ((uint32_t) p->histo[i+1] << 16));
+    }
+
+    if(++profilerPublishIdx >= PROFILER_PROBES) profilerPublishIdx = 0;
+}
+
+/** @}*/
+
+#endif // _PROFILER_ENABLED_
@@ -0,0 +1,174 @@
+#ifndef _PROFILER_H
+#define _PROFILER_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#ifdef __XC32
+#include "definitions.h"
+#endif
+
+#undef ext
+#undef ext_static
+
+#ifdef _PROFILER_C
+    #define ext
+    #define ext_static static
+#else
+    #define ext extern
+    #define ext_static extern
+#endif
+
+/*!
+ * \defgroup PROFMOD Hot-Path Profiler Module
+ * \ingroup applicationModule
+ *
+ * This module measures the execution time of the application hot paths.
+ *
+ * ## Module Function Description
+ *
+ * The code to be measured is enclosed between the PROFILE_BEGIN(id) and
+ * PROFILE_END(id) macros, where id is one of the \ref PROFILER_PROBE_t items.
+ *
+ * + On the target the time is sampled with the Cortex-M4 DWT cycle counter (CYCCNT):
+ * the unit is the CPU clock cycle (8.33ns @ 120MHz);
+ * + On a host build (no __XC32 defined) the time is sampled with clock_gettime(CLOCK_MONOTONIC):
+ * the unit is the nanosecond;
+ *
+ * For every probe the module keeps in RAM:
+ * + the number of samples;
+ * + the minimum, the maximum and the mean value;
+ * + an histogram of 8 bins, each 4 times larger than the previous one (see \ref PROFILER_HISTO_BASE_SHIFT);
+ *
+ * The statistics are published in the \ref PROFILER_DATA_BASE_IDX DATA register range,
+ * one probe for every PROFILE_PUBLISH() call, so the CAN loop is charged of
+ * only 8 register copies per cycle.
+ *
+ * The DATA register slot of a probe is fixed by its position in \ref PROFILER_PROBE_t:
+ * the new probes are appended at the end of the list and the removed probes 
+ * leave a spare slot, so the slots of the remote tools do not change.
+ *
+ * ## Compilation Switch
+ *
+ * The module is compiled only if the _PROFILER_ENABLED_ symbol is defined
+ * (see application.h or the project preprocessor macros).
+ * Without the symbol all the macros expand to nothing, the probe
+ * counters are not allocated and the DATA register range is not implemented:
+ * the profiler has no cost in the production code.
+ *
+ * ## Module API
+ *
+ * + PROFILE_INIT(): enables the cycle counter and clears the statistics;
+ * + PROFILE_BEGIN(id): samples the start time of the probe id;
+ * + PROFILE_END(id): samples the end time of the probe id and upgrades its statistics;
+ * + PROFILE_PUBLISH(): copies the statistics of the next probe into its DATA registers;
+ * + PROFILE_RESET(): clears the statistics of all the probes;
+ *
+ *  @{
+ */
+
+/// List of the implemented probes
+typedef enum{
+    PROFILE_MOTOR_LOOP = 0,     //!< motorLoop() execution
+    PROFILE_CAN_LOOP,           //!< MET_Can_Protocol_Loop() execution
+    PROFILE_GET_X,              //!< GetX() ADC read
+    PROFILE_GET_Y,              //!< GetY() ADC read
+    PROFILE_GET_Z,              //!< GetZ() ADC read
+    PROFILE_GET_SH,             //!< GetSHSensor() ADC read
+    PROFILE_SPARE_6,            //!< Not used (former XScrollDetection() probe, see PROFILE_SENSOR_CLASSIFIER)
+    PROFILE_SPARE_7,            //!< Not used (former NeedleIdDetection() probe, see PROFILE_SENSOR_CLASSIFIER)
+    PROFILE_SPARE_8,            //!< Not used (former YFlipDetection() probe, see PROFILE_SENSOR_CLASSIFIER)
+    PROFILE_POWER_DETECTION,    //!< MotorPowerSupplyDetection() and MonitorDetection() execution
+    PROFILE_KEYBOARD,           //!< KeyboardHandler() execution
+    PROFILE_STOP_ISR,           //!< ADC0/ADC1 WINMON handlers motor stop (software stop path)
+    PROFILE_SENSOR_SNAPSHOT,    //!< SensorSnapshotUpdate() ADC reads
+    PROFILE_SENSOR_CLASSIFIER,  //!< classifierRun() of the slow sensors
+    PROFILE_STOP_HW_TEST,       //!< motorStopLatencyTest(): EVSYS event to MOT_STOP low (hardware stop chain)
+    PROFILE_STOP_SW_TEST,       //!< motorStopLatencyTest(): pending WINMON interrupt to MOT_STOP low (software stop path)
+    PROFILER_PROBES             //!< Number of the implemented probes
+}PROFILER_PROBE_t;
+
+#define PROFILER_HISTO_BINS         8   //!< Number of histogram bins of a probe
+#define PROFILER_HISTO_BASE_SHIFT   6   //!< The bin 0 collects the samples < 2^6 units, the bin n < 2^(6+2n) units
+
+/**
+ *
+ * ### PROFILER DATA REGISTERS
+ *
+ * Every probe makes use of \ref PROFILER_REGISTERS_PER_PROBE DATA registers,
+ * starting from the address \ref PROFILER_DATA_BASE_IDX + probe * \ref PROFILER_REGISTERS_PER_PROBE.
+ *
+ * All the values are little endian.
+ *
+ * |OFFSET|NAME|DESCRIPTION|
+ * |:--|:--|:--|
+ * |0|MIN|32 bit minimum time|
+ * |1|MAX|32 bit maximum time|
+ * |2|MEAN|32 bit mean time|
+ * |3|COUNT|32 bit number of samples|
+ * |4|HISTO[0:1]|16 bit (saturated) counters of the bins 0 and 1|
+ * |5|HISTO[2:3]|16 bit (saturated) counters of the bins 2 and 3|
+ * |6|HISTO[4:5]|16 bit (saturated) counters of the bins 4 and 5|
+ * |7|HISTO[6:7]|16 bit (saturated) counters of the bins 6 and 7|
+ *
+ */
+#define PROFILER_DATA_BASE_IDX          1 //!< First DATA register of the profiler range
+#define PROFILER_REGISTERS_PER_PROBE    8 //!< Number of DATA registers for each probe
+
+#ifdef _PROFILER_ENABLED_
+    #define PROFILER_DATA_REGISTERS     (PROFILER_PROBES * PROFILER_REGISTERS_PER_PROBE) //!< Number of DATA registers of the profiler range
+#else
+    #define PROFILER_DATA_REGISTERS     0
+#endif
+
+/// Statistics of a single probe
+typedef struct{
+    uint32_t count;     //!< Number of samples
+    uint32_t min;       //!< Minimum sampled time
+    uint32_t max;       //!< Maximum sampled time
+    uint64_t sum;       //!< Sum of the samples (mean = sum / count)
+    uint16_t histo[PROFILER_HISTO_BINS]; //!< Histogram bins (saturated)
+}PROFILER_PROBE_STAT_t;
+
+#ifdef _PROFILER_ENABLED_
+
+    #ifdef __XC32
+        #define PROFILER_TIMESTAMP()    (DWT->CYCCNT) //!< Cycle counter sample
+    #else
+        /// Host time sample in ns
+        ext uint32_t profilerHostTimestamp(void);
+        #define PROFILER_TIMESTAMP()    profilerHostTimestamp()
+    #endif
+
+    /// Profiler initialization: it enables the DWT cycle counter
+    ext void profilerInit(void);
+
+    /// Clears the statistics of all the probes
+    ext void profilerReset(void);
+
+    /// Adds a sample to the statistics of a probe
+    ext void profilerRecord(PROFILER_PROBE_t id, uint32_t t);
+
+    /// Publishes the next probe statistics into the DATA registers
+    ext void profilerPublish(void);
+
+    /// Returns the statistics of a probe
+    ext const PROFILER_PROBE_STAT_t* profilerGetStat(PROFILER_PROBE_t id);
+
+    #define PROFILE_INIT()      profilerInit()
+    #define PROFILE_RESET()     profilerReset()
+    #define PROFILE_PUBLISH()   profilerPublish()
+    #define PROFILE_BEGIN(id)   uint32_t _profiler_t0_##id = PROFILER_TIMESTAMP()
+    #define PROFILE_END(id)     profilerRecord(id, PROFILER_TIMESTAMP() - _profiler_t0_##id)
+
+#else
+    #define PROFILE_INIT()
+    #define PROFILE_RESET()
+    #define PROFILE_PUBLISH()
+    #define PROFILE_BEGIN(id)
+    #define PROFILE_END(id)
+#endif
+
+/** @}*/
+
+#endif // _PROFILER_H
@@ -3,8 +3,13 @@
 #include "application.h"
 #include "protocol.h"
 #include "../Motors/motors.h"
+#include "../main.h"
+#include "../Trace/trace.h"
+#include "../Calibration/calibration.h"
+#include "../BootTime/boottime.h"
 
 static void ApplicationProtocolCommandHandler(uint8_t cmd, uint8_t d0,uint8_t d1,uint8_t d2,uint8_t d3 ); //!< This is the Command protocol callback
+static void updateParamStoreRegister(void); //!< Upgrades the parameter store STATUS register
 
 /**
  * This function initializes the CAN Protocol module.
@@ -27,6 +32,21 @@ void ApplicationProtocolInit ( void )
     // Initialize the Met Can Library
     MET_Can_Protocol_Init(MET_CAN_APP_DEVICE_ID, MET_CAN_STATUS_REGISTERS, MET_CAN_DATA_REGISTERS, MET_CAN_PARAM_REGISTERS, APPLICATION_MAJ_REV, APPLICATION_MIN_REV, APPLICATION_SUB_REV, ApplicationProtocolCommandHandler);
     
+    // The ABORT frames brake the motor from the reception interrupt
+    MET_Can_Protocol_SetAbortHandler(motorAbortFast);
+    
+    // Default calibration parameters (used only if the parameters have never been stored)
+    MET_Can_Protocol_SetDefaultParameter(PARAM_X_CALIB_IDX, CALIB_DEFAULT_OFFSET, 0, CALIB_DEFAULT_X_GAIN & 0xFF, CALIB_DEFAULT_X_GAIN >> 8);
+    MET_Can_Protocol_SetDefaultParameter(PARAM_Y_CALIB_IDX, CALIB_DEFAULT_OFFSET, 0, CALIB_DEFAULT_Y_GAIN & 0xFF, CALIB_DEFAULT_Y_GAIN >> 8);
+    MET_Can_Protocol_SetDefaultParameter(PARAM_Z_CALIB_IDX, CALIB_DEFAULT_OFFSET, 0, CALIB_DEFAULT_Z_GAIN & 0xFF, CALIB_DEFAULT_Z_GAIN >> 8);
+    MET_Can_Protocol_SetDefaultParameter(PARAM_X_LIMITS_IDX, CALIB_DEFAULT_X_MAX_dm & 0xFF, CALIB_DEFAULT_X_MAX_dm >> 8, CALIB_DEFAULT_X_TIMEOUT & 0xFF, CALIB_DEFAULT_X_TIMEOUT >> 8);
+    MET_Can_Protocol_SetDefaultParameter(PARAM_Y_LIMITS_IDX, CALIB_DEFAULT_Y_MAX_dm & 0xFF, CALIB_DEFAULT_Y_MAX_dm >> 8, CALIB_DEFAULT_Y_TIMEOUT & 0xFF, CALIB_DEFAULT_Y_TIMEOUT >> 8);
+    MET_Can_Protocol_SetDefaultParameter(PARAM_Z_LIMITS_IDX, CALIB_DEFAULT_Z_MAX_dm & 0xFF, CALIB_DEFAULT_Z_MAX_dm >> 8, CALIB_DEFAULT_Z_TIMEOUT & 0xFF, CALIB_DEFAULT_Z_TIMEOUT >> 8);
+    MET_Can_Protocol_SetDefaultParameter(PARAM_OBSTACLE_IDX, CALIB_DEFAULT_OBSTACLE_BLANK, CALIB_DEFAULT_OBSTACLE_DELAY, CALIB_DEFAULT_OBSTACLE_DELTA, 0);
+    MET_Can_Protocol_SetDefaultParameter(PARAM_POWER_TABLE_0_IDX, CALIB_DEFAULT_POWER_TABLE_0);
+    MET_Can_Protocol_SetDefaultParameter(PARAM_POWER_TABLE_1_IDX, CALIB_DEFAULT_POWER_TABLE_1);
+    MET_Can_Protocol_SetDefaultParameter(PARAM_KEYSTEP_IDX, CALIB_DEFAULT_KEYSTEP_STEP, CALIB_DEFAULT_KEYSTEP_DELAY, CALIB_DEFAULT_KEYSTEP_STAGE, CALIB_DEFAULT_KEYSTEP_MAX);
+    
 }
   
 /**
@@ -42,9 +62,24 @@ void inline ApplicationProtocolLoop(void){
     updateStatusRegister((void*) &StatusXYPositionRegister);
     updateStatusRegister((void*) &StatusZPositionRegister);
     updateStatusRegister((void*) &StatusAnalogRegister);
+    updateStatusRegister((void*) &StatusLoopRateRegister);
+    updateStatusRegister((void*) &StatusLoopTimeRegister);
+    updateStatusRegister((void*) &StatusTickOverrunRegister);
+    updateStatusRegister((void*) &StatusMonitorRegister);
+    updateStatusRegister((void*) &StatusAbortLatencyRegister);
+    updateStatusRegister((void*) &StatusSafetyRegister);
+    updateParamStoreRegister();
+    
+    // Publishes the profiler statistics
+    PROFILE_PUBLISH();
     
     // Handles the transmission/reception protocol
+    PROFILE_BEGIN(PROFILE_CAN_LOOP);
     MET_Can_Protocol_Loop();        
+    PROFILE_END(PROFILE_CAN_LOOP);
+    
+    // Marks the first answer to the remote host (boot time)
+    if(MET_Can_Protocol_IsResetNotified()) bootTimeMark(BOOT_PHASE_ANSWER);
     
 }
 
@@ -63,6 +98,9 @@ void ApplicationProtocolCommandHandler(uint8_t cmd, uint8_t d0,uint8_t d1,uint8_
          * 
          * This command aborts any pending command.
          * 
+         * The motor is already braked by the CAN reception interrupt (ABORT fast path):
+         * the activation terminates at the next 7.8ms tick.
+         * 
          * @param cmd = \ref MET_COMMAND_ABORT;
          * @param d0 = not used
          * @param d1 = not used
@@ -365,6 +403,10 @@ void ApplicationProtocolCommandHandler(uint8_t cmd, uint8_t d0,uint8_t d1,uint8_
          * This command enables/disables the Key Step mode.\n
          * The command enable can only be executed in MOTOR COMMAND working mode.
          * 
+         * In Key Step mode the keyboard jogs the axes: a tap executes a single step,
+         * holding the key the steps are repeated with an increasing distance until
+         * the axis moves continuously (see the Key Step PARAMETER register and the \ref MOTMOD module).
+         * 
          * @param cmd = \ref CMD_ENABLE_KEYSTEP;
          * @param d0: 0=Disbaled; 1=Enabled;
          * @param d1: not used
@@ -423,6 +465,193 @@ void ApplicationProtocolCommandHandler(uint8_t cmd, uint8_t d0,uint8_t d1,uint8_
             else MET_Can_Protocol_returnCommandExecuted(0,0);
             break;
           
+#ifdef _PROFILER_ENABLED_
+        /**
+         * <div style="page-break-after: always;"></div>
+         * \addtogroup CANPROT 
+         * ### PROFILER RESET COMMAND
+         * 
+         * This command clears the statistics of all the profiler probes,
+         * then repeats the stop latency test if the motor driver is disabled (see motorStopLatencyTest()).\n
+         * The command is implemented only if the _PROFILER_ENABLED_ symbol is defined.
+         * 
+         * @param cmd = \ref CMD_PROFILER_RESET;
+         * @param d0: not used
+         * @param d1: not used
+         * @param d2: not used
+         * @param d3: not used
+         * 
+         * @return
+         * 
+         * + ImmediateExecuted(0,0)
+         * 
+         */
+        case CMD_PROFILER_RESET:
+            PROFILE_RESET();
+            motorStopLatencyTest();
+            MET_Can_Protocol_returnCommandExecuted(0,0);
+            break;
+#endif
+            
+        /**
+         * <div style="page-break-after: always;"></div>
+         * \addtogroup CANPROT 
+         * ### TIMING RESET COMMAND
+         * 
+         * This command clears the worst case values of the LOOP TIME register,
+         * the merged event counters of the TICK OVERRUN register,
+         * the worst CAN reception to transmission latency,
+         * the worst latencies of the ABORT LATENCY register
+         * and the edge counters of the SAFETY FEEDBACK register.
+         * 
+         * @param cmd = \ref CMD_TIMING_RESET;
+         * @param d0: not used
+         * @param d1: not used
+         * @param d2: not used
+         * @param d3: not used
+         * 
+         * @return
+         * 
+         * + ImmediateExecuted(0,0)
+         * 
+         */
+        case CMD_TIMING_RESET:
+            TimingTelemetryReset();
+            MET_Can_Protocol_returnCommandExecuted(0,0);
+            break;
+            
+        /**
+         * <div style="page-break-after: always;"></div>
+         * \addtogroup CANPROT 
+         * ### TRACE STREAM COMMAND
+         * 
+         * This command handles the event trace streaming (see \ref TRACEMOD).
+         * 
+         * When the streaming is started, the records present in the trace ring
+         * are sent in background on the CAN Id 0x180 + \ref MET_CAN_APP_DEVICE_ID, 
+         * one 8 byte record per frame, followed by an end of stream record.
+         * 
+         * @param cmd = \ref CMD_TRACE_STREAM;
+         * @param d0: 0 = stop the streaming; 1 = start the streaming; 2 = clear the trace;
+         * @param d1: not used
+         * @param d2: not used
+         * @param d3: not used
+         * 
+         * @return
+         * 
+         */
+        case CMD_TRACE_STREAM:
+            
+            if(d0 == 1){
+                /// \addtogroup CANPROT
+                /// \test start: ImmediateExecuted(NL,NH) with N = number of records to be streamed
+                uint16_t n = traceStreamStart();
+                MET_Can_Protocol_returnCommandExecuted((uint8_t) (n & 0xff), (uint8_t) (n >> 8));
+            }else if(d0 == 0){
+                /// \addtogroup CANPROT
+                /// \test stop: ImmediateExecuted(0,0)
+                traceStreamStop();
+                MET_Can_Protocol_returnCommandExecuted(0,0);
+            }else if(d0 == 2){
+                /// \addtogroup CANPROT
+                /// \test clear: ImmediateExecuted(0,0)
+                traceClear();
+                MET_Can_Protocol_returnCommandExecuted(0,0);
+            }else{
+                /// \addtogroup CANPROT
+                /// \test invalid d0: ImmediateError(\ref MET_CAN_COMMAND_INVALID_DATA)
+                MET_Can_Protocol_returnCommandError(MET_CAN_COMMAND_INVALID_DATA);
+            }
+            break;
+            
+        /**
+         * <div style="page-break-after: always;"></div>
+         * \addtogroup CANPROT 
+         * ### CALIBRATION SWEEP COMMAND
+         * 
+         * This command fills the position linearization table of an axis (see \ref CALIBMOD).
+         * 
+         * The sweep procedure is the following:
+         * + START: the sweep is started on the axis selected with d1;
+         * + POINT: the axis is moved to a position (with the keyboard in Calibration mode 
+         * or with the MOVE commands in Command mode), the actual position is measured 
+         * with an external reference and passed to the command: the device samples the 
+         * position sensor and stores the pair. The step is repeated along the whole stroke;
+         * + END: the table breakpoints are calculated, written into the LUT PARAMETER registers
+         * and become immediatelly operative. The STORE_PARAMS frame makes them persistent;
+         * 
+         * The CLEAR action returns the axis to the linear conversion (offset and gain).
+         * 
+         * @param cmd = \ref CMD_CALIB_SWEEP;
+         * @param d0: 0 = START; 1 = POINT; 2 = END; 3 = CLEAR;
+         * @param d1: START, CLEAR: axis (0 = X, 1 = Y, 2 = Z); POINT: low byte of the reference position (0.1mm);
+         * @param d2: POINT: high byte of the reference position (0.1mm);
+         * @param d3: not used
+         * 
+         * @return
+         * 
+         */
+        case CMD_CALIB_SWEEP:
+            
+            /// \addtogroup CANPROT
+            /// \test activation pending: ImmediateError(\ref MET_CAN_COMMAND_BUSY)
+            if(motorStruct.command_mode.command != MOTOR_COMMAND_NO_COMMAND){
+                MET_Can_Protocol_returnCommandError(MET_CAN_COMMAND_BUSY);
+                break;
+            }
+            
+            if((d0 == 0) && (d1 < CALIB_AXES)){
+                /// \addtogroup CANPROT
+                /// \test start: ImmediateExecuted(0,0)
+                calibrationSweepStart((CALIB_AXIS_t) d1);
+                MET_Can_Protocol_returnCommandExecuted(0,0);
+            }else if(d0 == 1){
+                int axis = calibrationSweepAxis();
+                
+                /// \addtogroup CANPROT
+                /// \test point without start: ImmediateError(\ref MET_CAN_COMMAND_NOT_ENABLED)
+                if(axis < 0){
+                    MET_Can_Protocol_returnCommandError(MET_CAN_COMMAND_NOT_ENABLED);
+                    break;
+                }
+                
+                // Averages the position sensor (offset removed)
+                int u = 0;
+                for(int i=0; i < 8; i++){
+                    if(axis == CALIB_AXIS_X){ GetX(); u += deviceStruct.sensors.x; }
+                    else if(axis == CALIB_AXIS_Y){ GetY(); u += deviceStruct.sensors.y; }
+                    else { GetZ(); u += deviceStruct.sensors.z; }
+                }
+                
+                int n = calibrationSweepPoint((u + 4) >> 3, (int) d1 + (int) d2 * 256);
+                
+                /// \addtogroup CANPROT
+                /// \test point table full: ImmediateError(\ref MET_CAN_COMMAND_INVALID_DATA)
+                if(n < 0) MET_Can_Protocol_returnCommandError(MET_CAN_COMMAND_INVALID_DATA);
+                
+                /// \addtogroup CANPROT
+                /// \test point: ImmediateExecuted(N,0) with N = number of collected points
+                else MET_Can_Protocol_returnCommandExecuted((uint8_t) n, 0);
+            }else if(d0 == 2){
+                /// \addtogroup CANPROT
+                /// \test end with less than 2 points or non monotonic positions: ImmediateError(\ref MET_CAN_COMMAND_INVALID_DATA)
+                if(!calibrationSweepEnd()) MET_Can_Protocol_returnCommandError(MET_CAN_COMMAND_INVALID_DATA);
+                
+                /// \addtogroup CANPROT
+                /// \test end: ImmediateExecuted(0,0)
+                else MET_Can_Protocol_returnCommandExecuted(0,0);
+            }else if((d0 == 3) && (d1 < CALIB_AXES)){
+                /// \addtogroup CANPROT
+                /// \test clear: ImmediateExecuted(0,0)
+                calibrationLutClear((CALIB_AXIS_t) d1);
+                MET_Can_Protocol_returnCommandExecuted(0,0);
+            }else{
+                /// \addtogroup CANPROT
+                /// \test invalid d0 or axis: ImmediateError(\ref MET_CAN_COMMAND_INVALID_DATA)
+                MET_Can_Protocol_returnCommandError(MET_CAN_COMMAND_INVALID_DATA);
+            }
+            break;
+            
          /**
          * <div style="page-break-after: always;"></div>
          * \addtogroup CANPROT 
@@ -449,4 +678,22 @@ void updateDataRegister(void* reg){
     ((REGISTER_STRUCT_t*) reg)->d2 = MET_Can_Protocol_GetData(((REGISTER_STRUCT_t*) reg)->idx, 2);
     ((REGISTER_STRUCT_t*) reg)->d3 = MET_Can_Protocol_GetData(((REGISTER_STRUCT_t*) reg)->idx, 3);
     
-}
\ No newline at end of file
+}
+/**
+ * This function upgrades the Parameter Store STATUS register 
+ * with the MET CAN library store engine data.
+ */
+static void updateParamStoreRegister(void){
+    uint32_t writes = MET_Can_Protocol_GetStoreWrites();
+    uint16_t realloc = MET_Can_Protocol_GetStoreReallocations();
+    
+    if(writes > 0xFFFFFF) writes = 0xFFFFFF;
+    if(realloc > 127) realloc = 127;
+    
+    StatusParamStoreRegister.W0 = (unsigned char) (writes & 0xFF);
+    StatusParamStoreRegister.W1 = (unsigned char) ((writes >> 8) & 0xFF);
+    StatusParamStoreRegister.W2 = (unsigned char) ((writes >> 16) & 0xFF);
+    StatusParamStoreRegister.realloc = (unsigned char) realloc;
+    StatusParamStoreRegister.pending = MET_Can_Protocol_IsStorePending();
+    updateStatusRegister((void*) &StatusParamStoreRegister);
+}
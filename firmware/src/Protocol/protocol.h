@@ -4,6 +4,7 @@
 #include "definitions.h"  
 #include "application.h"  
 #include "Shared/CAN/MET_can_protocol.h"
+#include "Profiler/profiler.h"
 
 #undef ext
 #undef ext_static
@@ -61,9 +62,9 @@ typedef struct {
 /// Protocol Definition Data
 typedef enum{
     MET_CAN_APP_DEVICE_ID    =  0x15,      //!< Application DEVICE CAN Id address
-    MET_CAN_STATUS_REGISTERS =  4,        //!< Defines the total number of implemented STATUS registers 
-    MET_CAN_DATA_REGISTERS   =  1,        //!< Defines the total number of implemented Application DATA registers 
-    MET_CAN_PARAM_REGISTERS  =  0       //!< Defines the total number of implemented PARAMETER registers 
+    MET_CAN_STATUS_REGISTERS =  14,        //!< Defines the total number of implemented STATUS registers 
+    MET_CAN_DATA_REGISTERS   =  PROFILER_DATA_BASE_IDX + PROFILER_DATA_REGISTERS, //!< Defines the total number of implemented Application DATA registers 
+    MET_CAN_PARAM_REGISTERS  =  37      //!< Defines the total number of implemented PARAMETER registers 
 }PROTOCOL_DEFINITION_DATA_t;
 
 /**
@@ -113,6 +114,17 @@ ext void updateDataRegister(void* reg);
  * |0|Mode Register|\ref STATUS_MODE_t|
  * |1|Position XY Register|\ref STATUS_XY_POSITION_t|
  * |2|Position Z Register|\ref STATUS_Z_POSITION_t|
+ * |3|Analog Register|\ref STATUS_ANALOG_t|
+ * |4|Loop Rate Register|\ref STATUS_LOOP_RATE_t|
+ * |5|Loop Time Register|\ref STATUS_LOOP_TIME_t|
+ * |6|Tick Overrun Register|\ref STATUS_TICK_OVERRUN_t|
+ * |7|Parameter Store Register|\ref STATUS_PARAM_STORE_t|
+ * |8|Boot Time 0 Register|\ref STATUS_BOOT_TIME_t|
+ * |9|Boot Time 1 Register|\ref STATUS_BOOT_TIME_t|
+ * |10|Boot Answer Register|\ref STATUS_BOOT_ANSWER_t|
+ * |11|Monitor Register|\ref STATUS_MONITOR_t|
+ * |12|Abort Latency Register|\ref STATUS_ABORT_LATENCY_t|
+ * |13|Safety Feedback Register|\ref STATUS_SAFETY_t|
  *   
  */
 
@@ -123,6 +135,16 @@ typedef enum{
   STATUS_XY_POSITION_IDX = 1,//!< Status Position for the X and Y coordinate 
   STATUS_Z_POSITION_IDX = 2,//!< Status Position for the Z coordinate 
   STATUS_ANALOG_IDX = 3,//!< Status Analog Inputs 
+  STATUS_LOOP_RATE_IDX = 4,//!< Main loop iterations rate
+  STATUS_LOOP_TIME_IDX = 5,//!< Main loop worst iteration time and CAN latency
+  STATUS_TICK_OVERRUN_IDX = 6,//!< Missed (merged) periodic task events
+  STATUS_PARAM_STORE_IDX = 7,//!< Parameter store and SmartEEPROM wear monitoring
+  STATUS_BOOT_TIME_0_IDX = 8,//!< Boot time: clock and system initialization phases
+  STATUS_BOOT_TIME_1_IDX = 9,//!< Boot time: protocol initialization and main loop start
+  STATUS_BOOT_ANSWER_IDX = 10,//!< Boot time: first answer and reset cause
+  STATUS_MONITOR_IDX = 11,//!< Supply monitor channels and over-current events
+  STATUS_ABORT_LATENCY_IDX = 12,//!< ABORT command worst latencies
+  STATUS_SAFETY_IDX = 13,//!< Safety feedback inputs edges
 }STATUS_INDEX_t;
 
 /**
@@ -174,6 +196,9 @@ typedef enum{
      * |1.1|General enable|this is the current general enable status|
      * |1.2|Keyboard enable|this is the current keyboard enable status|
      * |1.3|Needle Status|status of the needle disable signal|
+     * |1.4|Interlock enabled|the CCL interlock is enabled in the current mode|
+     * |1.5|Interlock keys|the button of a key requested activation is an interlock input|
+     * |1.6|Interlock armed|the CCL interlock is armed (activation in progress)|
      * |2.0|Key Step mode activation bit|This is the current status of the Key Step mode|
      * |2.1|Y Up position detected|This is the current detected Y-UP status|
      * |2..|-|-|
@@ -191,7 +216,10 @@ typedef enum{
         unsigned char power_sw_general_enable:1;    //!< General enable bit
         unsigned char power_sw_keyboard_enable:1;   //!< Keyboard enable bit
         unsigned char power_sw_needle_disable:1;    //!< Needle disable bit
-        unsigned char d1:4;                         //!< Spare bits at the byte 1.4 to 1.7
+        unsigned char interlock_enabled:1;          //!< CCL interlock enabled in the current mode
+        unsigned char interlock_keys:1;             //!< CCL interlock with the button input
+        unsigned char interlock_armed:1;            //!< CCL interlock armed
+        unsigned char d1:1;                         //!< Spare bit at the byte 1.7
 
         unsigned char keystep_mode_enabled:1;       //!< Key Step enable bit
         unsigned char y_up_detected:1;              //!< Status of the Y UP position detection
@@ -275,6 +303,287 @@ typedef enum{
         unsigned char KEYBOARD;     //!< Keyboard activation status
     }STATUS_ANALOG_t;
     
+    /**
+     * \addtogroup CANPROT
+     * 
+     * ### LOOP RATE STATUS REGISTER
+     * 
+     * + Description: STATUS_LOOP_RATE_t;
+     * + IDX: \ref STATUS_LOOP_RATE_IDX;
+     * 
+     * |BYTE.BIT|NAME|DESCRIPTION|
+     * |:--|:--|:--|
+     * |0|L0|Byte 0 of the 32 bit loop counter|
+     * |1|L1|Byte 1 of the 32 bit loop counter|
+     * |2|L2|Byte 2 of the 32 bit loop counter|
+     * |3|L3|Byte 3 of the 32 bit loop counter|
+     * 
+     * + Loops = L0 + 256 * L1 + 65536 * L2 + 16777216 * L3: 
+     * is the number of main loop iterations executed in the last 1024ms period.
+     */ 
+    
+    /// \ingroup CANPROT
+    /// Status Loop Rate description structure
+    typedef struct {
+        const unsigned char idx;
+        unsigned char L0; //!< Byte 0 of the loop counter
+        unsigned char L1; //!< Byte 1 of the loop counter
+        unsigned char L2; //!< Byte 2 of the loop counter
+        unsigned char L3; //!< Byte 3 of the loop counter
+    }STATUS_LOOP_RATE_t;
+    
+    /**
+     * \addtogroup CANPROT
+     * 
+     * ### LOOP TIME STATUS REGISTER
+     * 
+     * + Description: STATUS_LOOP_TIME_t;
+     * + IDX: \ref STATUS_LOOP_TIME_IDX;
+     * 
+     * |BYTE.BIT|NAME|DESCRIPTION|
+     * |:--|:--|:--|
+     * |0|TL|Low byte of the worst main loop iteration time|
+     * |1|TH|High byte of the worst main loop iteration time|
+     * |2|LL|Low byte of the worst CAN reception to transmission latency|
+     * |3|LH|High byte of the worst CAN reception to transmission latency|
+     * 
+     * + Iteration time = TL + 256 * TH: is expressed in us (saturated to 65535);
+     * + Latency = LL + 256 * LH: is expressed in us (CAN bit times @ 1Mbit/s);
+     * 
+     * The values are the worst cases since the startup or the last \ref CMD_TIMING_RESET command.
+     */ 
+    
+    /// \ingroup CANPROT
+    /// Status Loop Time description structure
+    typedef struct {
+        const unsigned char idx;
+        unsigned char TL; //!< Low byte of the worst iteration time
+        unsigned char TH; //!< High byte of the worst iteration time
+        unsigned char LL; //!< Low byte of the worst CAN latency
+        unsigned char LH; //!< High byte of the worst CAN latency
+    }STATUS_LOOP_TIME_t;
+    
+    /**
+     * \addtogroup CANPROT
+     * 
+     * ### TICK OVERRUN STATUS REGISTER
+     * 
+     * + Description: STATUS_TICK_OVERRUN_t;
+     * + IDX: \ref STATUS_TICK_OVERRUN_IDX;
+     * 
+     * Every byte counts the periodic events raised by the RTC 
+     * while the same event was still pending in the main loop:
+     * the two events are merged and one execution of the periodic task is lost.
+     * 
+     * The counts refer to the last 1024ms period: they are latched and restarted
+     * every 1024ms, as the \ref STATUS_LOOP_RATE_IDX register.
+     * 
+     * |BYTE.BIT|NAME|DESCRIPTION|
+     * |:--|:--|:--|
+     * |0|T7|Merged 7.8ms events (motorLoop())|
+     * |1|T15|Merged 15.6ms events|
+     * |2|T128|Merged 128ms events|
+     * |3|T1024|Merged 1024ms events|
+     * 
+     * The counters saturate to 255 within the period.
+     */ 
+    
+    /// \ingroup CANPROT
+    /// Status Tick Overrun description structure
+    typedef struct {
+        const unsigned char idx;
+        unsigned char T7;    //!< Merged 7.8ms events
+        unsigned char T15;   //!< Merged 15.6ms events
+        unsigned char T128;  //!< Merged 128ms events
+        unsigned char T1024; //!< Merged 1024ms events
+    }STATUS_TICK_OVERRUN_t;
+    
+    /**
+     * \addtogroup CANPROT
+     * 
+     * ### PARAMETER STORE STATUS REGISTER
+     * 
+     * + Description: STATUS_PARAM_STORE_t;
+     * + IDX: \ref STATUS_PARAM_STORE_IDX;
+     * 
+     * The STORE_PARAMS frame is executed in background: 
+     * only the PARAMETER registers different from the SmartEEPROM content are written.
+     * 
+     * |BYTE.BIT|NAME|DESCRIPTION|
+     * |:--|:--|:--|
+     * |0|W0|Byte 0 of the 24 bit SmartEEPROM write counter|
+     * |1|W1|Byte 1 of the 24 bit SmartEEPROM write counter|
+     * |2|W2|Byte 2 of the 24 bit SmartEEPROM write counter|
+     * |3.0:6|REALLOC|SmartEEPROM sector reallocations since the startup (saturated to 127)|
+     * |3.7|PENDING|A parameter store is in progress|
+     * 
+     * + Writes = W0 + 256 * W1 + 65536 * W2: is the number of 32 bit words written
+     * into the SmartEEPROM since the first store (saturated to 0xFFFFFF),
+     * kept into the SmartEEPROM for the wear monitoring.
+     * 
+     * The store completion is reported also into the Command register (see the MET CAN library).
+     */ 
+    
+    /// \ingroup CANPROT
+    /// Status Parameter Store description structure
+    typedef struct {
+        const unsigned char idx;
+        unsigned char W0;           //!< Byte 0 of the write counter
+        unsigned char W1;           //!< Byte 1 of the write counter
+        unsigned char W2;           //!< Byte 2 of the write counter
+        unsigned char realloc:7;    //!< Sector reallocations since the startup
+        unsigned char pending:1;    //!< A parameter store is in progress
+    }STATUS_PARAM_STORE_t;
+    
+    /**
+     * \addtogroup CANPROT
+     * 
+     * ### BOOT TIME STATUS REGISTERS
+     * 
+     * + Description: STATUS_BOOT_TIME_t, STATUS_BOOT_ANSWER_t;
+     * + IDX: \ref STATUS_BOOT_TIME_0_IDX, \ref STATUS_BOOT_TIME_1_IDX, \ref STATUS_BOOT_ANSWER_IDX;
+     * 
+     * The registers report the time from the reset vector 
+     * to the end of every boot phase (see the \ref BOOTTIMEMOD module),
+     * in 10us units (saturated to 0xFFFF). A zero value means a phase not yet completed.
+     * 
+     * |IDX|BYTE 0:1|BYTE 2:3|
+     * |:--|:--|:--|
+     * |8|CLOCK: CPU clock switched to 120MHz|SYSTEM: SYS_Initialize() completed|
+     * |9|PROTOCOL: protocol initialized|LOOP: main loop started|
+     * 
+     * |BYTE.BIT|NAME|DESCRIPTION|
+     * |:--|:--|:--|
+     * |0|TL|Low byte of the ANSWER time (first answer to the remote host)|
+     * |1|TH|High byte of the ANSWER time|
+     * |2|RCAUSE|Reset cause (RSTC RCAUSE register)|
+     * |3|-|Reserved|
+     */ 
+    
+    /// \ingroup CANPROT
+    /// Status Boot Time description structure
+    typedef struct {
+        const unsigned char idx;
+        unsigned char T0L; //!< Low byte of the first phase time
+        unsigned char T0H; //!< High byte of the first phase time
+        unsigned char T1L; //!< Low byte of the second phase time
+        unsigned char T1H; //!< High byte of the second phase time
+    }STATUS_BOOT_TIME_t;
+    
+    /// \ingroup CANPROT
+    /// Status Boot Answer description structure
+    typedef struct {
+        const unsigned char idx;
+        unsigned char TL;       //!< Low byte of the first answer time
+        unsigned char TH;       //!< High byte of the first answer time
+        unsigned char RCAUSE;   //!< Reset cause
+        unsigned char spare;    //!< Reserved
+    }STATUS_BOOT_ANSWER_t;
+    
+    /**
+     * \addtogroup CANPROT
+     * 
+     * ### MONITOR STATUS REGISTER
+     * 
+     * + Description: STATUS_MONITOR_t;
+     * + IDX: \ref STATUS_MONITOR_IDX;
+     * 
+     * The register reports the supply monitor channels, acquired every 7.8ms:
+     * 
+     * |BYTE.BIT|NAME|DESCRIPTION|
+     * |:--|:--|:--|
+     * |0|REF_12V|ANL_REFERENCE_12V input (ADC units, 3.3V/255)|
+     * |1|REF_5VEXT|ANL_REFERENCE_5VEXT input (ADC units, 3.3V/255)|
+     * |2.0|POWER_OK|POWER_OK input status|
+     * |2.1:7|-|Reserved|
+     * |3|OVERCURRENT|Activations stopped for over-current since the startup (saturated to 255)|
+     * 
+     * The motor supply (ANL_MONITOR_VM) is reported into the Analog Register (MOTOR_POWER).
+     */ 
+    
+    /// \ingroup CANPROT
+    /// Status Monitor description structure
+    typedef struct {
+        const unsigned char idx;
+        unsigned char REF_12V;      //!< 12V reference input (ADC units)
+        unsigned char REF_5VEXT;    //!< 5V external reference input (ADC units)
+        unsigned char power_ok:1;   //!< POWER_OK input status
+        unsigned char spare:7;      //!< Reserved
+        unsigned char OVERCURRENT;  //!< Over-current stops since the startup
+    }STATUS_MONITOR_t;
+    
+    /**
+     * \addtogroup CANPROT
+     * 
+     * ### ABORT LATENCY STATUS REGISTER
+     * 
+     * + Description: STATUS_ABORT_LATENCY_t;
+     * + IDX: \ref STATUS_ABORT_LATENCY_IDX;
+     * 
+     * The ABORT command frame is detected by the CAN reception interrupt,
+     * that brakes the motor without waiting for the main loop (see the \ref MOTMOD module).
+     * 
+     * |BYTE.BIT|NAME|DESCRIPTION|
+     * |:--|:--|:--|
+     * |0|BL|Low byte of the worst ABORT reception to motor brake latency|
+     * |1|BH|High byte of the worst ABORT reception to motor brake latency|
+     * |2|AL|Low byte of the worst ABORT reception to answer transmission latency|
+     * |3|AH|High byte of the worst ABORT reception to answer transmission latency|
+     * 
+     * + Latency = L + 256 * H: is expressed in us (CAN bit times @ 1Mbit/s),
+     * from the start of the received frame;
+     * 
+     * The values are the worst cases since the startup or the last \ref CMD_TIMING_RESET command.
+     */ 
+    
+    /// \ingroup CANPROT
+    /// Status Abort Latency description structure
+    typedef struct {
+        const unsigned char idx;
+        unsigned char BL; //!< Low byte of the worst brake latency
+        unsigned char BH; //!< High byte of the worst brake latency
+        unsigned char AL; //!< Low byte of the worst answer latency
+        unsigned char AH; //!< High byte of the worst answer latency
+    }STATUS_ABORT_LATENCY_t;
+    
+    /**
+     * \addtogroup CANPROT
+     * 
+     * ### SAFETY FEEDBACK STATUS REGISTER
+     * 
+     * + Description: STATUS_SAFETY_t;
+     * + IDX: \ref STATUS_SAFETY_IDX;
+     * 
+     * The motor and needle power switch feedback inputs are monitored 
+     * by the EIC interrupts on both the edges (without debouncer),
+     * so the glitches of the safety chain are detected:
+     * 
+     * |BYTE.BIT|NAME|DESCRIPTION|
+     * |:--|:--|:--|
+     * |0|ME|Edges of the motor power switch feedback (saturated to 255)|
+     * |1|NE|Edges of the needle power switch feedback (saturated to 255)|
+     * |2|MP|Shortest pulse of the motor power switch feedback (0.1ms units, saturated to 255)|
+     * |3|NP|Shortest pulse of the needle power switch feedback (0.1ms units, saturated to 255)|
+     * 
+     * + A pulse is the time between two edges (either level): 0 means no pulse completed;
+     * a pulse shorter than the interrupt latency is reported as 0.1ms;
+     * + Every edge is also recorded in the event trace (TRACE_SAFETY_EDGE) with its time.
+     * 
+     * The values are cleared with the \ref CMD_TIMING_RESET command.
+     * A drop of the motor power switch during an activation terminates
+     * the command with the MOTOR_ERROR_POWER_SWITCH error code.
+     */ 
+    
+    /// \ingroup CANPROT
+    /// Status Safety Feedback description structure
+    typedef struct {
+        const unsigned char idx;
+        unsigned char ME; //!< Motor feedback edges
+        unsigned char NE; //!< Needle feedback edges
+        unsigned char MP; //!< Motor feedback shortest pulse (0.1ms)
+        unsigned char NP; //!< Needle feedback shortest pulse (0.1ms)
+    }STATUS_SAFETY_t;
+    
     
     #ifdef _PROTOCOL_C
         /// \ingroup CANPROT
@@ -293,11 +602,58 @@ typedef enum{
         /// Declaration of the Status Analog Registers
         STATUS_ANALOG_t StatusAnalogRegister = {.idx=STATUS_ANALOG_IDX};
         
+        /// \ingroup CANPROT
+        /// Declaration of the Status Loop Rate Register
+        STATUS_LOOP_RATE_t StatusLoopRateRegister = {.idx=STATUS_LOOP_RATE_IDX};
+        
+        /// \ingroup CANPROT
+        /// Declaration of the Status Loop Time Register
+        STATUS_LOOP_TIME_t StatusLoopTimeRegister = {.idx=STATUS_LOOP_TIME_IDX};
+        
+        /// \ingroup CANPROT
+        /// Declaration of the Status Tick Overrun Register
+        volatile STATUS_TICK_OVERRUN_t StatusTickOverrunRegister = {.idx=STATUS_TICK_OVERRUN_IDX};
+        
+        /// \ingroup CANPROT
+        /// Declaration of the Status Parameter Store Register
+        STATUS_PARAM_STORE_t StatusParamStoreRegister = {.idx=STATUS_PARAM_STORE_IDX};
+        
+        /// \ingroup CANPROT
+        /// Declaration of the Status Boot Time Registers
+        STATUS_BOOT_TIME_t StatusBootTime0Register = {.idx=STATUS_BOOT_TIME_0_IDX};
+        STATUS_BOOT_TIME_t StatusBootTime1Register = {.idx=STATUS_BOOT_TIME_1_IDX};
+        
+        /// \ingroup CANPROT
+        /// Declaration of the Status Boot Answer Register
+        STATUS_BOOT_ANSWER_t StatusBootAnswerRegister = {.idx=STATUS_BOOT_ANSWER_IDX};
+        
+        /// \ingroup CANPROT
+        /// Declaration of the Status Monitor Register
+        STATUS_MONITOR_t StatusMonitorRegister = {.idx=STATUS_MONITOR_IDX};
+        
+        /// \ingroup CANPROT
+        /// Declaration of the Status Abort Latency Register
+        STATUS_ABORT_LATENCY_t StatusAbortLatencyRegister = {.idx=STATUS_ABORT_LATENCY_IDX};
+        
+        /// \ingroup CANPROT
+        /// Declaration of the Status Safety Feedback Register
+        volatile STATUS_SAFETY_t StatusSafetyRegister = {.idx=STATUS_SAFETY_IDX};
+        
     #else
         extern STATUS_MODE_t StatusModeRegister;
         extern STATUS_XY_POSITION_t StatusXYPositionRegister;
         extern STATUS_Z_POSITION_t StatusZPositionRegister;
         extern STATUS_ANALOG_t StatusAnalogRegister;
+        extern STATUS_LOOP_RATE_t StatusLoopRateRegister;
+        extern STATUS_LOOP_TIME_t StatusLoopTimeRegister;
+        extern volatile STATUS_TICK_OVERRUN_t StatusTickOverrunRegister;
+        extern STATUS_PARAM_STORE_t StatusParamStoreRegister;
+        extern STATUS_BOOT_TIME_t StatusBootTime0Register;
+        extern STATUS_BOOT_TIME_t StatusBootTime1Register;
+        extern STATUS_BOOT_ANSWER_t StatusBootAnswerRegister;
+        extern STATUS_MONITOR_t StatusMonitorRegister;
+        extern STATUS_ABORT_LATENCY_t StatusAbortLatencyRegister;
+        extern volatile STATUS_SAFETY_t StatusSafetyRegister;
     #endif  
     
 //________________________________________ DATA REGISTER DEFINITION SECTION _   
@@ -307,11 +663,89 @@ typedef enum{
 * 
 * ## DATA register description
 * 
-*  No DATA registers are implemented. 
+*  The DATA register 0 is not used.
 *
+*  If the _PROFILER_ENABLED_ symbol is defined, the DATA registers
+*  starting from \ref PROFILER_DATA_BASE_IDX publish the statistics of
+*  the hot-path profiler (see \ref PROFMOD). 
 *   
 */
 
+
+//________________________________________ PARAMETER REGISTER DEFINITION SECTION _   
+
+/**
+ * \addtogroup CANPROT
+ * 
+ * ## PARAMETER register description
+ * 
+ * The PARAMETER registers hold the calibration parameters of the device 
+ * (see the \ref CALIBMOD module).
+ * 
+ * The registers are loaded from the SmartEEPROM at the startup and 
+ * are made persistent with the STORE_PARAMS frame: 
+ * the stored values become operative at the storage time. 
+ * A register set to 0 (never stored), erased (0xFF) or out of the valid range
+ * selects the default value (see calibrationLoad()).
+ * 
+ * All the 16 bit values are little endian.
+ * 
+ * |IDX|NAME|D0-D1|D2-D3|
+ * |:--|:--|:--|:--|
+ * |0|X Calibration|Signed ADC offset|Gain: ADC units / 100mm|
+ * |1|Y Calibration|Signed ADC offset|Gain: ADC units / 100mm|
+ * |2|Z Calibration|Signed ADC offset|Gain: ADC units / 100mm|
+ * |3|X Limits|Max target position (0.1mm)|Activation timeout (7.8ms units)|
+ * |4|Y Limits|Max target position (0.1mm)|Activation timeout (7.8ms units)|
+ * |5|Z Limits|Max target position (0.1mm)|Activation timeout (7.8ms units)|
+ * 
+ * |IDX|NAME|D0|D1|D2|D3|
+ * |:--|:--|:--|:--|:--|:--|
+ * |6|Obstacle|Blank time (7.8ms units)|Test period (7.8ms units)|Min position change (0.1mm)|-|
+ * |7|Power Table 0|Level 1 distance (mm)|Level 2 distance (mm)|Level 3 distance (mm)|Level 4 distance (mm)|
+ * |8|Power Table 1|Level 5 distance (mm)|Level 6 distance (mm)|Level 7 distance (mm)|-|
+ * |36|Key Step|Single step (0.1mm)|Repeat delay (7.8ms units)|Steps of a ramp stage|Max step (mm)|
+ * 
+ * |IDX|NAME|D0-D1|D2-D3|
+ * |:--|:--|:--|:--|
+ * |9+N|X LUT N|Signed position (0.1mm) at ADC = 512 * N|Signed position (0.1mm) at ADC = 512 * N + 256|
+ * |18+N|Y LUT N|Signed position (0.1mm) at ADC = 512 * N|Signed position (0.1mm) at ADC = 512 * N + 256|
+ * |27+N|Z LUT N|Signed position (0.1mm) at ADC = 512 * N|Signed position (0.1mm) at ADC = 512 * N + 256|
+ * 
+ * The LUT registers (N = 0 to 8) hold the 17 breakpoints of the position linearization table
+ * of the axis (ADC with the offset removed; D2-D3 of the register 8 is not used):
+ * they are filled by the \ref CMD_CALIB_SWEEP command.
+ * A LUT with non monotonic breakpoints (for example all zero) is not used and the position
+ * is calculated with the offset and gain of the axis.
+ * 
+ * + The position in 0.1mm is: (ADC - offset) * 1000 / gain;
+ * + The obstacle is detected when the position changes less than the Min position change 
+ * during a Test period, after the Blank time from the activation start;
+ * + The power level N is applied when the distance from the target is greater than
+ * the Level N distance (the distances shall be strictly ascending);
+ * + The Key Step register sets the keyboard jog of the Key Step mode (see \ref CMD_ENABLE_KEYSTEP):
+ * the step is doubled every Steps of a ramp stage and the motion becomes continuous
+ * when the step exceeds the Max step.
+ * 
+ */
+
+/// \ingroup CANPROT
+/// Defines the address table for the Parameter Registers 
+typedef enum{
+  PARAM_X_CALIB_IDX = 0,        //!< X position sensor calibration
+  PARAM_Y_CALIB_IDX = 1,        //!< Y position sensor calibration
+  PARAM_Z_CALIB_IDX = 2,        //!< Z position sensor calibration
+  PARAM_X_LIMITS_IDX = 3,       //!< X activation limits
+  PARAM_Y_LIMITS_IDX = 4,       //!< Y activation limits
+  PARAM_Z_LIMITS_IDX = 5,       //!< Z activation limits
+  PARAM_OBSTACLE_IDX = 6,       //!< Obstacle detection setting
+  PARAM_POWER_TABLE_0_IDX = 7,  //!< Power level distance table (levels 1 to 4)
+  PARAM_POWER_TABLE_1_IDX = 8,  //!< Power level distance table (levels 5 to 7)
+  PARAM_X_LUT_IDX = 9,          //!< X linearization table (9 registers)
+  PARAM_Y_LUT_IDX = 18,         //!< Y linearization table (9 registers)
+  PARAM_Z_LUT_IDX = 27,         //!< Z linearization table (9 registers)
+  PARAM_KEYSTEP_IDX = 36,       //!< Key Step mode jog setting
+}PARAM_INDEX_t;
     
 //_______________________________________ PROTOCOL COMMANDS DEFINITION SECTION _        
         
@@ -331,6 +765,10 @@ typedef enum{
  * + [7] CMD_MOVE_Z: Z motor activation;
  * + [8] CMD_ENABLE_KEYSTEP: KeyStep enable command;
  * + [9] CMD_SERVICE_TEST_CYCLE: cycle test command;
+ * + [10] CMD_PROFILER_RESET: clears the profiler statistics (only with _PROFILER_ENABLED_);
+ * + [11] CMD_TIMING_RESET: clears the main loop timing and tick overrun registers;
+ * + [12] CMD_TRACE_STREAM: starts/stops the event trace streaming or clears the trace;
+ * + [13] CMD_CALIB_SWEEP: position linearization sweep;
  * 
  */     
 
@@ -346,7 +784,11 @@ typedef enum{
    CMD_MOVE_Y = 6,              //!< Moves the Y position command
    CMD_MOVE_Z = 7,              //!< Moves the Z position command
    CMD_ENABLE_KEYSTEP = 8,       //!< Enable/Disable the Key Step mode (only in COMMAND mode)
-   CMD_SERVICE_TEST_CYCLE = 9   //!< Service Cycle Test activatioin command    
+   CMD_SERVICE_TEST_CYCLE = 9,  //!< Service Cycle Test activatioin command    
+   CMD_PROFILER_RESET = 10,     //!< Profiler statistics reset command
+   CMD_TIMING_RESET = 11,       //!< Timing telemetry reset command
+   CMD_TRACE_STREAM = 12,       //!< Event trace streaming command
+   CMD_CALIB_SWEEP = 13         //!< Position linearization sweep command
 }PROTOCOL_COMMANDS_t;
     
         
@@ -355,6 +797,8 @@ typedef enum{
     MOTOR_ERROR_TIMEOUT,      
     MOTOR_ERROR_KEY_RELEASED,      
     MOTOR_ERROR_KEY_PRESSED,
+    MOTOR_ERROR_OVERCURRENT,
+    MOTOR_ERROR_POWER_SWITCH,
             
 }PROTOCOL_APPLICATION_ERROR_t;
 
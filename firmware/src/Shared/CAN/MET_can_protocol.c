@@ -2,6 +2,9 @@
 
 #include "application.h"                // SYS function prototypes
 #include "MET_can_protocol.h" 
+#ifdef _MET_MOTOR_BRIDGE_
+#include "interrupts.h"                 // CAN0 Harmony interrupt handler
+#endif
 
 
 /**
@@ -50,6 +53,10 @@
             bool bootloader_present; //!< This is the flag that is true if a bootloader is present
             bool appreset_request; //!< This is the flag to request a soft reset to activate the loader
             
+            MET_errorHandler_t applicationErrorHandler; //!< This is the optional application error callback
+            MET_paramHandler_t applicationParamHandler; //!< This is the optional application parameter storage callback
+            MET_abortHandler_t applicationAbortHandler; //!< This is the optional application ABORT fast path callback
+            
         } MET_Protocol_Data_t;
         
         static MET_Protocol_Data_t MET_Protocol_Data_Struct; //!< This is the internal protocol data structure
@@ -76,9 +83,49 @@
             uint8_t tx_message[8]; //!< Transmitting data byte
             uint8_t tx_messageLength;//!< transmitting data lenght
 
+            uint16_t max_latency; //!< Worst reception to transmission time (us)
+            uint16_t max_abort_latency; //!< Worst ABORT reception to fast path callback completion time (us)
+            uint16_t max_abort_answer_latency; //!< Worst ABORT reception to transmission time (us)
+
         } MET_Can_Protocol_RxTx_t;        
         static MET_Can_Protocol_RxTx_t MET_Can_Protocol_RxTx_Struct; //!< This is the structure handling the data transmitted and received
         
+        /// Parameter store engine phases
+        typedef enum{
+            MET_STORE_CHECK = 0,    //!< Compares the registers with the last good image
+            MET_STORE_DATA,         //!< Writes the changed data words into the target slot
+            MET_STORE_SEQUENCE,     //!< Writes the sequence number of the new image
+            MET_STORE_DESCRIPTOR,   //!< Writes the descriptor of the new image
+            MET_STORE_CRC,          //!< Writes the CRC32: the new image becomes valid
+            MET_STORE_WEAR,         //!< Writes the wear counter
+        }MET_STORE_PHASE_t;
+        
+         /** 
+         * @brief Parameter store engine data
+         * 
+         * This structure is internally used to write the PARAMETER registers
+         * into the SmartEEPROM in background (see MET_Can_Protocol_Store_Loop()).
+         * 
+         * The SmartEEPROM holds two image slots (A and B): 
+         * every store is written into the slot not holding the last good image.
+         * 
+         */  
+        typedef struct {
+            bool pending;           //!< A STORE_PARAMS is in progress
+            MET_STORE_PHASE_t phase;//!< Current store phase
+            uint8_t idx;            //!< Next PARAMETER register to be compared with the SmartEEPROM
+            uint16_t written;       //!< Words written by the current store
+            uint32_t writes;        //!< Words written since the first store (wear counter)
+            uint16_t reallocations; //!< Active sector reallocations since the startup
+            
+            int8_t slot;            //!< Slot of the last good image (-1 if no image is present)
+            uint8_t len;            //!< Number of PARAMETER registers of the last good image
+            uint32_t sequence;      //!< Sequence number of the last good image
+            uint32_t crc;           //!< CRC32 of the last good image
+            uint32_t new_crc;       //!< CRC32 of the image in store
+        } MET_Param_Store_t;
+        static MET_Param_Store_t MET_Param_Store_Struct; //!< This is the structure handling the parameter store
+        
         
     /**
      * \defgroup metCanHarmony Harmony 3 necessary declarations
@@ -111,6 +158,38 @@
 
         #define TEST_EEPROM_INDEX       255
 
+        /// SmartEEPROM word holding the number of words written since the first store
+        #define WEAR_EEPROM_INDEX       254
+
+        /// SmartEEPROM size in 32 bit words
+        #define MET_EEPROM_WORDS        256
+
+        /// SmartEEPROM words of a parameter image slot (slot A from word 0, slot B from word 124)
+        #define MET_EEPROM_SLOT_WORDS   (MET_EEPROM_SLOT_HEADER + MET_EEPROM_IMAGE_WORDS)
+
+        /// Header words of a parameter image slot: descriptor, sequence number, CRC32
+        #define MET_EEPROM_SLOT_HEADER  3
+
+        /// Image descriptor word: tag (bit 16:31), layout version (bit 8:15), number of registers (bit 0:7)
+        #define MET_EEPROM_DESCRIPTOR(len) (((uint32_t) MET_EEPROM_IMAGE_TAG << 16) | ((uint32_t) MET_EEPROM_IMAGE_VERSION << 8) | (len))
+        #define MET_EEPROM_IMAGE_TAG        0x4D50  //!< Descriptor tag of a parameter image
+        #define MET_EEPROM_IMAGE_VERSION    1       //!< Layout version of a parameter image
+
+        /// Clears the SmartEEPROM active sector full flag
+        #ifndef MET_SEESFULL_CLEAR
+        #define MET_SEESFULL_CLEAR() (NVMCTRL_REGS->NVMCTRL_INTFLAG = NVMCTRL_INTFLAG_SEESFULL_Msk)
+        #endif
+
+        /// Current value of the CAN0 timestamp counter (1 bit time / tick: 1us @ 1Mbit/s)
+        #ifndef MET_CAN_TIMESTAMP
+        #define MET_CAN_TIMESTAMP() ((uint16_t) (CAN0_REGS->CAN_TSCV & CAN_TSCV_TSC_Msk))
+        #endif
+
+        /// Number of free elements of the CAN0 TX FIFO
+        #ifndef MET_CAN_TX_FIFO_FREE
+        #define MET_CAN_TX_FIFO_FREE() ((CAN0_REGS->CAN_TXFQS & CAN_TXFQS_TFFL_Msk) >> CAN_TXFQS_TFFL_Pos)
+        #endif
+
     /** @}*/  // metCanHarmony
     
      /**
@@ -124,19 +203,34 @@
         static void MET_DefaultError_Callback(uint8_t event); 
 
         /// Interrupt routine
-        static void MET_Can_Protocol_Reception_Callback(uintptr_t context); 
+        static void HOT_CODE MET_Can_Protocol_Reception_Callback(uintptr_t context); 
         static void MET_Can_AppRestartCallback(uintptr_t context);
         
         /// Reception activation routine
         static void MET_Can_Protocol_Reception_Trigger(void);     
         
+        /// Transmits a 8 byte frame on CAN0 (main loop context)
+        static bool MET_Can_Transmit(uint32_t id, uint8_t* data);
+        
+        /// Sends the protocol answer and rearms the reception
+        static void MET_Can_Protocol_Answer(uint32_t id);
+        
         static bool rxReceptionTrigger = false; //!< RX received frame flag
         static bool rxErrorTrigger = false;//!< TX received frame flag
         static bool rxBootloaderReceptionTrigger = false; //!< RX received frame flag
         static bool rxBootloaderErrorTrigger = false;//!< TX received frame flag
+        static bool rxAbortTrigger = false; //!< The received frame is an ABORT handled by the fast path
+        static bool txAnswerPending = false; //!< The protocol answer waits for a free TX FIFO element
+        static uint32_t txAnswerId = 0; //!< CAN Id of the pending protocol answer
+        static uint8_t rxLastSequence = 0; //!< Sequence number of the last processed frame
+        
+        static void HOT_CODE MET_Can_Protocol_Abort_Detect(void);
         
         static void MET_Can_Application_Loop(void);
         static void MET_Can_Bootloader_Loop(void);
+        static void MET_Can_Protocol_Store_Loop(void);
+        static void MET_Can_Protocol_Store_Restart(void);
+        static void MET_Can_Protocol_Image_Load(void);
         
     /** @}*/  // metCanLocal
 
@@ -158,11 +252,20 @@ void MET_Can_Protocol_Reception_Trigger(void){
     CAN0_RxCallbackRegister( MET_Can_Protocol_Reception_Callback, 0 , CAN_MSG_ATTR_RX_FIFO0 );
     
     // Activate the reception buffer on the FIFO-0
-    if (CAN0_MessageReceive(&MET_Can_Protocol_RxTx_Struct.rx_messageID,
+#ifdef _MET_MOTOR_BRIDGE_
+    // The bridge interrupts modify the CAN0 interrupt enable register too
+    uint32_t primask = __get_PRIMASK();
+    __disable_irq();
+#endif
+    bool armed = CAN0_MessageReceive(&MET_Can_Protocol_RxTx_Struct.rx_messageID,
             &MET_Can_Protocol_RxTx_Struct.rx_messageLength,
             MET_Can_Protocol_RxTx_Struct.rx_message,
             &MET_Can_Protocol_RxTx_Struct.rx_timestamp,
-            CAN_MSG_ATTR_RX_FIFO0, &msgFrameAttr0) == false)  MET_DefaultError_Callback(MET_CAN_PROTOCOL_ERROR_RECEPTION_ACTIVATION);
+            CAN_MSG_ATTR_RX_FIFO0, &msgFrameAttr0);
+#ifdef _MET_MOTOR_BRIDGE_
+    __set_PRIMASK(primask);
+#endif
+    if (armed == false)  MET_DefaultError_Callback(MET_CAN_PROTOCOL_ERROR_RECEPTION_ACTIVATION);
     
     return;
 }
@@ -221,18 +324,13 @@ void MET_Can_Protocol_Init(uint8_t devId, uint8_t statReg, uint8_t dataReg, uint
     if((paramReg) && (NVMCTRL_SEESBLK_FuseConfig == MET_EEPROM_BLK) && (NVMCTRL_SEEPSZ_FuseConfig == MET_EEPROM_PSZ)){
         MET_Protocol_Data_Struct.applicationParameterArrayLen = paramReg;
 
+        if(paramReg > MET_EEPROM_IMAGE_WORDS) MET_Protocol_Data_Struct.applicationParameterArrayLen = MET_EEPROM_IMAGE_WORDS;
+
         // Wait the Smart Eeeprom busy condition before to proceed
         while (NVMCTRL_SmartEEPROM_IsBusy()) ;
         
-        // Test if the EEPROM has been initialized
-        if (SMEE_CUSTOM_SIG == SmartEEPROM32[TEST_EEPROM_INDEX])
-        {        
-            // Upload the eeprom with the stored data
-            for(int i=0; i< paramReg;i++) *((uint32_t*) MET_Protocol_Data_Struct.pApplicationParameterArray[i].d) = SmartEEPROM32[i];
-            
-        }else{
-            for(int i=0; i< paramReg;i++) memset(MET_Protocol_Data_Struct.pApplicationParameterArray[i].d,0,4);
-        }
+        // Loads the last good parameter image
+        MET_Can_Protocol_Image_Load();
         
     }else MET_Protocol_Data_Struct.applicationParameterArrayLen = 0;    
     
@@ -398,6 +496,25 @@ uint8_t  MET_Can_Protocol_GetData(uint8_t idx, uint8_t data_index){
 }
 
  
+/**
+ * This function sets a byte of a Data register.
+ * 
+ * The DATA registers are normally written by the remote device:
+ * the function allows the Application to publish internal data
+ * (diagnostic counters, statistics) in a DATA register range.
+ * 
+ * @param idx index of the Data register
+ * @param data_index index of the register data content [0:3]
+ * @param val value to be assigned
+ * 
+ */
+void  MET_Can_Protocol_SetDataReg(uint8_t idx, uint8_t data_index, uint8_t val){
+    if((idx < MET_Protocol_Data_Struct.applicationDataArrayLen) && (data_index < 4)) {
+        MET_Protocol_Data_Struct.pApplicationDataArray[idx].d[data_index] = val;
+    }    
+    return;
+}
+
 /**
  * This function tests a bit field condition on a Data register.
  * 
@@ -436,8 +553,9 @@ uint8_t  MET_Can_Protocol_GetParameter(uint8_t idx, uint8_t data_index){
 /**
  * This function sets the default value of a parameter
  * 
- * This function will work ONLY if the EEPROM has not yet stored
- * with the MASTER parameter data 
+ * This function will work ONLY if the parameter is not part 
+ * of the image loaded from the SmartEEPROM: the registers added
+ * by a new revision get their default value also on a stored device.
  * 
  * @param idx index of the target parameter
  * @param d0 data d0
@@ -448,8 +566,9 @@ uint8_t  MET_Can_Protocol_GetParameter(uint8_t idx, uint8_t data_index){
  */
 void  MET_Can_Protocol_SetDefaultParameter(uint8_t idx, uint8_t d0, uint8_t d1, uint8_t d2, uint8_t d3){
     
-    if (SMEE_CUSTOM_SIG == SmartEEPROM32[TEST_EEPROM_INDEX]) return;
+    // The index is tested first: without PARAMETER registers the SmartEEPROM may be not configured
     if(idx >= MET_Protocol_Data_Struct.applicationParameterArrayLen) return;
+    if(idx < MET_Param_Store_Struct.len) return;
     
     MET_Protocol_Data_Struct.pApplicationParameterArray[idx].d[0] = d0;
     MET_Protocol_Data_Struct.pApplicationParameterArray[idx].d[1] = d1;
@@ -459,6 +578,24 @@ void  MET_Can_Protocol_SetDefaultParameter(uint8_t idx, uint8_t d0, uint8_t d1,
     return ;
 }
 
+/**
+ * This function sets a byte of a PARAMETER register.
+ * 
+ * The function is used by the Application to change a parameter
+ * calculated internally (for example with a calibration procedure):
+ * the value is made persistent with the STORE_PARAMS frame.
+ * 
+ * @param idx index of the PARAMETER register
+ * @param data_index index of the register data content [0:3]
+ * @param val value to be assigned
+ */
+void  MET_Can_Protocol_SetParameterReg(uint8_t idx, uint8_t data_index, uint8_t val){
+    if((idx < MET_Protocol_Data_Struct.applicationParameterArrayLen) && (data_index < 4)) {
+        MET_Protocol_Data_Struct.pApplicationParameterArray[idx].d[data_index] = val;
+        MET_Can_Protocol_Store_Restart();
+    }
+}
+
 /**
  * This function tests a bit field condition on a PARAMETER register.
  * 
@@ -507,9 +644,350 @@ void MET_Can_Protocol_returnCommandAborted(void){
     return;
 }
 
+/**
+ * This function returns the worst time elapsed from the reception 
+ * of an application frame and the transmission of its answer.
+ * 
+ * The time is the difference between the CAN0 timestamp counter
+ * at the transmission and the timestamp of the received frame (start of frame),
+ * so it includes the frame reception time and the main loop polling time.
+ * 
+ * @return the worst latency in bit time units (us @ 1Mbit/s)
+ */
+uint16_t MET_Can_Protocol_GetMaxLatency(void){
+    return MET_Can_Protocol_RxTx_Struct.max_latency;
+}
+
+/// This function resets the worst reception to transmission latency (ABORT latencies included)
+void MET_Can_Protocol_ResetMaxLatency(void){
+    MET_Can_Protocol_RxTx_Struct.max_latency = 0;
+    MET_Can_Protocol_RxTx_Struct.max_abort_latency = 0;
+    MET_Can_Protocol_RxTx_Struct.max_abort_answer_latency = 0;
+}
+
+/**
+ * This function returns the worst time elapsed from the reception 
+ * of an ABORT command frame and the completion of the Application
+ * fast path callback (see MET_Can_Protocol_SetAbortHandler()).
+ * 
+ * @return the worst latency in bit time units (us @ 1Mbit/s)
+ */
+uint16_t MET_Can_Protocol_GetMaxAbortLatency(void){
+    return MET_Can_Protocol_RxTx_Struct.max_abort_latency;
+}
+
+/**
+ * This function returns the worst time elapsed from the reception 
+ * of an ABORT command frame handled by the fast path and the transmission of its answer.
+ * 
+ * @return the worst latency in bit time units (us @ 1Mbit/s)
+ */
+uint16_t MET_Can_Protocol_GetMaxAbortAnswerLatency(void){
+    return MET_Can_Protocol_RxTx_Struct.max_abort_answer_latency;
+}
+
+/**
+ * This function returns true when the device reset 
+ * has been notified to the remote host: the first answer 
+ * with the RESET code has been sent (or a Bootloader command has been received).
+ * 
+ * @return true if the reset has been notified
+ */
+bool MET_Can_Protocol_IsResetNotified(void){
+    return !MET_Protocol_Data_Struct.device_reset;
+}
+
 void MET_Can_Protocol_Loop(void){
-    if(rxReceptionTrigger  || rxErrorTrigger) MET_Can_Application_Loop();
+    if(txAnswerPending) MET_Can_Protocol_Answer(txAnswerId);
+    else if(rxReceptionTrigger  || rxErrorTrigger) MET_Can_Application_Loop();
     else if (rxBootloaderReceptionTrigger  || rxBootloaderErrorTrigger) MET_Can_Bootloader_Loop();
+    
+    // Background parameter store
+    if(MET_Param_Store_Struct.pending) MET_Can_Protocol_Store_Loop();
+}
+
+/**
+ * This function updates a CRC32 (IEEE 802.3, reflected) with a 32 bit word.
+ * 
+ * The word is processed LSB first with a 16 entries table (a nibble per step).
+ * 
+ * @param crc current CRC value
+ * @param word word to be added
+ * @return the updated CRC value
+ */
+static uint32_t MET_Crc32_Word(uint32_t crc, uint32_t word){
+    static const uint32_t crcTable[16] = {
+        0x00000000, 0x1DB71064, 0x3B6E20C8, 0x26D930AC, 0x76DC4190, 0x6B6B51F4, 0x4DB26158, 0x5005713C,
+        0xEDB88320, 0xF00F9344, 0xD6D6A3E8, 0xCB61B38C, 0x9B64C2B0, 0x86D3D2D4, 0xA00AE278, 0xBDBDF21C
+    };
+    
+    crc ^= word;
+    for(int i=0; i<8; i++) crc = (crc >> 4) ^ crcTable[crc & 0x0F];
+    return crc;
+}
+
+/**
+ * This function calculates the CRC32 of a parameter image.
+ * 
+ * The CRC protects the descriptor, the sequence number and the data words.
+ * 
+ * @param descriptor image descriptor word
+ * @param sequence image sequence number
+ * @param data pointer to the data words
+ * @param len number of data words
+ * @return the CRC32 of the image
+ */
+static uint32_t MET_Crc32_Image(uint32_t descriptor, uint32_t sequence, const uint32_t* data, uint8_t len){
+    uint32_t crc = 0xFFFFFFFF;
+    
+    crc = MET_Crc32_Word(crc, descriptor);
+    crc = MET_Crc32_Word(crc, sequence);
+    for(int i=0; i<len; i++) crc = MET_Crc32_Word(crc, data[i]);
+    return ~crc;
+}
+
+/**
+ * This function loads the PARAMETER registers from the SmartEEPROM at the startup.
+ * 
+ * The whole SmartEEPROM is read with a single NVMCTRL_Read() and 
+ * the two image slots are verified: 
+ * + the descriptor shall have the expected tag and layout version;
+ * + the CRC32 shall match the descriptor, sequence and data content.
+ * 
+ * The valid image with the greatest sequence number is loaded. 
+ * A slot interrupted during a store (power loss) fails the CRC test,
+ * so the last good copy is always used.
+ * 
+ * The registers not present into the image are cleared
+ * and they get the default value with MET_Can_Protocol_SetDefaultParameter().
+ * 
+ * Without a valid image, the parameters stored by the previous revisions 
+ * (single copy validated by the SMEE_CUSTOM_SIG signature) are loaded: 
+ * they are considered the slot A content, so the first store is made into slot B.
+ */
+static void MET_Can_Protocol_Image_Load(void){
+    uint32_t image[MET_EEPROM_WORDS];
+    uint8_t paramReg = MET_Protocol_Data_Struct.applicationParameterArrayLen;
+    uint8_t len;
+    uint32_t* pSlot;
+    
+    NVMCTRL_Read(image, sizeof(image), SEEPROM_ADDR);
+    
+    MET_Param_Store_Struct.slot = -1;
+    MET_Param_Store_Struct.len = 0;
+    for(int8_t slot=0; slot<2; slot++){
+        pSlot = &image[slot * MET_EEPROM_SLOT_WORDS];
+        len = (uint8_t) pSlot[0];
+        if((len == 0) || (len > MET_EEPROM_IMAGE_WORDS) || (pSlot[0] != MET_EEPROM_DESCRIPTOR(len))) continue;
+        if(MET_Crc32_Image(pSlot[0], pSlot[1], &pSlot[MET_EEPROM_SLOT_HEADER], len) != pSlot[2]) continue;
+        
+        // The newest valid image (the sequence number can wrap)
+        if((MET_Param_Store_Struct.slot < 0) || ((int32_t) (pSlot[1] - MET_Param_Store_Struct.sequence) > 0)){
+            MET_Param_Store_Struct.slot = slot;
+            MET_Param_Store_Struct.len = len;
+            MET_Param_Store_Struct.sequence = pSlot[1];
+            MET_Param_Store_Struct.crc = pSlot[2];
+        }
+    }
+    
+    if(MET_Param_Store_Struct.slot >= 0){
+        pSlot = &image[MET_Param_Store_Struct.slot * MET_EEPROM_SLOT_WORDS + MET_EEPROM_SLOT_HEADER];
+    }else if(image[TEST_EEPROM_INDEX] == SMEE_CUSTOM_SIG){
+        pSlot = image;
+        MET_Param_Store_Struct.slot = 0;
+        MET_Param_Store_Struct.len = paramReg;
+        MET_Param_Store_Struct.sequence = 0;
+        MET_Param_Store_Struct.crc = ~MET_Crc32_Image(MET_EEPROM_DESCRIPTOR(paramReg), 0, image, paramReg); // never matches
+    }else pSlot = 0;
+    
+    for(int i=0; i< paramReg;i++){
+        if(i < MET_Param_Store_Struct.len) *((uint32_t*) MET_Protocol_Data_Struct.pApplicationParameterArray[i].d) = pSlot[i];
+        else memset(MET_Protocol_Data_Struct.pApplicationParameterArray[i].d,0,4);
+    }
+    
+    // Wear counter (erased word if never written)
+    MET_Param_Store_Struct.writes = (image[WEAR_EEPROM_INDEX] == 0xFFFFFFFF) ? 0 : image[WEAR_EEPROM_INDEX];
+}
+
+/**
+ * This function starts the background store of the PARAMETER registers.
+ * 
+ * The Command register reports the \ref MET_COMMAND_STORE_PARAMS command
+ * in EXECUTING status until the store is completed.
+ * 
+ * If a store is already in progress, it is restarted (see MET_Can_Protocol_Store_Restart()).
+ */
+static void MET_Can_Protocol_Store_Start(void){
+    MET_Protocol_Data_Struct.commandRegister.command = MET_COMMAND_STORE_PARAMS;
+    MET_Protocol_Data_Struct.commandRegister.status = MET_CAN_COMMAND_EXECUTING;
+    MET_Protocol_Data_Struct.commandRegister.result[0] = 0;
+    MET_Protocol_Data_Struct.commandRegister.result[1] = 0;
+    MET_Protocol_Data_Struct.commandRegister.error = MET_CAN_COMMAND_NO_ERROR;
+    
+    if(MET_Param_Store_Struct.pending){
+        MET_Can_Protocol_Store_Restart();
+        return;
+    }
+    
+    MET_Param_Store_Struct.written = 0;
+    MET_Param_Store_Struct.phase = MET_STORE_CHECK;
+    MET_Param_Store_Struct.pending = true;
+}
+
+/**
+ * This function restarts a pending store after a PARAMETER register change.
+ * 
+ * The data comparison is restarted from the first register:
+ * the words already written and not changed are not written again.
+ * The target slot remains the same, so the last good image is never touched.
+ */
+static void MET_Can_Protocol_Store_Restart(void){
+    if((!MET_Param_Store_Struct.pending) || (MET_Param_Store_Struct.phase == MET_STORE_CHECK)) return;
+    MET_Param_Store_Struct.phase = MET_STORE_DATA;
+    MET_Param_Store_Struct.idx = 0;
+}
+
+/**
+ * This function executes a slice of the background parameter store.
+ * 
+ * The function is called by the MET_Can_Protocol_Loop() while a store is pending
+ * and it never waits for the SmartEEPROM:
+ * + if the SmartEEPROM is busy, nothing is done;
+ * + if the active sector is full, the sector reallocation is requested;
+ * + otherwise at most one word is written.
+ * 
+ * The new image is written into the slot not holding the last good image:
+ * + if the registers match the last good image nothing is written;
+ * + up to \ref MET_EEPROM_STORE_SCAN registers are compared with the 
+ * target slot content and the first different one is written;
+ * + the sequence number and the descriptor are written;
+ * + the CRC32 is written last: the new image becomes valid with a single word write.
+ * 
+ * At the end:
+ * + the wear counter is updated (only if something has been written);
+ * + the Command register is set to EXECUTED with the number of written words;
+ * + the Application is notified with the registered parameter callback.
+ */
+static void MET_Can_Protocol_Store_Loop(void){
+    uint8_t len = MET_Protocol_Data_Struct.applicationParameterArrayLen;
+    const uint32_t* pParams = (const uint32_t*) MET_Protocol_Data_Struct.pApplicationParameterArray;
+    uint32_t* pSlot = &SmartEEPROM32[((MET_Param_Store_Struct.slot == 0) ? 1 : 0) * MET_EEPROM_SLOT_WORDS];
+    uint32_t val;
+    
+    // The SmartEEPROM cannot be accessed without stalling the bus
+    if(NVMCTRL_SmartEEPROM_IsBusy()) return;
+    
+    // Active sector full: the reallocation is executed before the next write
+    if(NVMCTRL_SmartEEPROM_IsActiveSectorFull()){
+        MET_SEESFULL_CLEAR();
+        NVMCTRL_SmartEEPROMSectorReallocate();
+        MET_Param_Store_Struct.reallocations++;
+        return;
+    }
+    
+    switch(MET_Param_Store_Struct.phase){
+        case MET_STORE_CHECK:
+            MET_Param_Store_Struct.idx = 0;
+            MET_Param_Store_Struct.phase = MET_STORE_DATA;
+            
+            // Nothing changed from the last good image
+            if((MET_Param_Store_Struct.slot >= 0) && (MET_Param_Store_Struct.len == len) &&
+               (MET_Crc32_Image(MET_EEPROM_DESCRIPTOR(len), MET_Param_Store_Struct.sequence, pParams, len) == MET_Param_Store_Struct.crc)){
+                MET_Param_Store_Struct.phase = MET_STORE_WEAR;
+            }
+            return;
+            
+        case MET_STORE_DATA:
+            for(int n=0; (n < MET_EEPROM_STORE_SCAN) && (MET_Param_Store_Struct.idx < len); n++){
+                val = pParams[MET_Param_Store_Struct.idx];
+                MET_Param_Store_Struct.idx++;
+
+                if(pSlot[MET_EEPROM_SLOT_HEADER + MET_Param_Store_Struct.idx - 1] != val){
+                    pSlot[MET_EEPROM_SLOT_HEADER + MET_Param_Store_Struct.idx - 1] = val;
+                    MET_Param_Store_Struct.written++;
+                    MET_Param_Store_Struct.writes++;
+                    return;
+                }
+            }
+            if(MET_Param_Store_Struct.idx < len) return;
+            
+            // The CRC is calculated on the stored data
+            MET_Param_Store_Struct.new_crc = MET_Crc32_Image(MET_EEPROM_DESCRIPTOR(len), MET_Param_Store_Struct.sequence + 1, &pSlot[MET_EEPROM_SLOT_HEADER], len);
+            MET_Param_Store_Struct.phase = MET_STORE_SEQUENCE;
+            return;
+            
+        case MET_STORE_SEQUENCE:
+            MET_Param_Store_Struct.phase = MET_STORE_DESCRIPTOR;
+            if(pSlot[1] != MET_Param_Store_Struct.sequence + 1){
+                pSlot[1] = MET_Param_Store_Struct.sequence + 1;
+                MET_Param_Store_Struct.written++;
+                MET_Param_Store_Struct.writes++;
+                return;
+            }
+            // falls through
+            
+        case MET_STORE_DESCRIPTOR:
+            MET_Param_Store_Struct.phase = MET_STORE_CRC;
+            if(pSlot[0] != MET_EEPROM_DESCRIPTOR(len)){
+                pSlot[0] = MET_EEPROM_DESCRIPTOR(len);
+                MET_Param_Store_Struct.written++;
+                MET_Param_Store_Struct.writes++;
+                return;
+            }
+            // falls through
+            
+        case MET_STORE_CRC:
+            // The new image is valid: it becomes the last good image
+            pSlot[2] = MET_Param_Store_Struct.new_crc;
+            MET_Param_Store_Struct.written++;
+            MET_Param_Store_Struct.writes++;
+            
+            MET_Param_Store_Struct.slot = (MET_Param_Store_Struct.slot == 0) ? 1 : 0;
+            MET_Param_Store_Struct.len = len;
+            MET_Param_Store_Struct.sequence++;
+            MET_Param_Store_Struct.crc = MET_Param_Store_Struct.new_crc;
+            MET_Param_Store_Struct.phase = MET_STORE_WEAR;
+            return;
+            
+        case MET_STORE_WEAR:
+            if((MET_Param_Store_Struct.written) && (SmartEEPROM32[WEAR_EEPROM_INDEX] != MET_Param_Store_Struct.writes)){
+                MET_Param_Store_Struct.writes++;
+                SmartEEPROM32[WEAR_EEPROM_INDEX] = MET_Param_Store_Struct.writes;
+                return;
+            }
+            break;
+    }
+    
+    MET_Param_Store_Struct.pending = false;
+    MET_Can_Protocol_returnCommandExecuted((uint8_t) MET_Param_Store_Struct.written, (uint8_t) (MET_Param_Store_Struct.written >> 8));
+    
+    // Notifies the Application that the stored parameters are the current ones
+    if(MET_Protocol_Data_Struct.applicationParamHandler) MET_Protocol_Data_Struct.applicationParamHandler();
+}
+
+/// This function returns true if a STORE_PARAMS is in progress
+bool MET_Can_Protocol_IsStorePending(void){
+    return MET_Param_Store_Struct.pending;
+}
+
+/**
+ * This function returns the number of words written into the SmartEEPROM 
+ * by the parameter store since the first store of the device 
+ * (the value is kept into the SmartEEPROM).
+ * 
+ * The SmartEEPROM makes the wear leveling of the words 
+ * on the whole sector: the counter can be compared with the
+ * sector endurance in order to estimate the residual life.
+ * 
+ * @return the number of written words
+ */
+uint32_t MET_Can_Protocol_GetStoreWrites(void){
+    return MET_Param_Store_Struct.writes;
+}
+
+/// This function returns the number of SmartEEPROM sector reallocations since the startup
+uint16_t MET_Can_Protocol_GetStoreReallocations(void){
+    return MET_Param_Store_Struct.reallocations;
 }
         
 /**
@@ -531,7 +1009,6 @@ void MET_Can_Protocol_Loop(void){
  */
 void MET_Can_Application_Loop(void){
     MET_Can_Frame_t* cmdFrame;
-    static uint8_t lastSequence = 0;
 
     uint8_t crc = 0;
     uint8_t i;
@@ -560,12 +1037,12 @@ void MET_Can_Application_Loop(void){
         cmdFrame = (MET_Can_Frame_t*) &MET_Can_Protocol_RxTx_Struct.rx_message;        
         
         // Veries if the sequence number is changed        
-        if(cmdFrame->seq == lastSequence) {
+        if(cmdFrame->seq == rxLastSequence) {
             MET_Can_Protocol_Reception_Trigger(); // Reschedule the new data reception
             return;
         }
         
-        lastSequence = cmdFrame->seq;
+        rxLastSequence = cmdFrame->seq;
         
         // Copy the received to the data that will be retransmitted 
         memcpy(MET_Can_Protocol_RxTx_Struct.tx_message, MET_Can_Protocol_RxTx_Struct.rx_message,8);
@@ -573,6 +1050,7 @@ void MET_Can_Application_Loop(void){
         // If the module has been reset, the first answer is a reset code
         if(MET_Protocol_Data_Struct.device_reset){
             MET_Protocol_Data_Struct.device_reset = false;
+            rxAbortTrigger = false;
             
             // Change the ack command code to the RESET code, to inform the MCPU that the device has been reset
             cmdFrame = (MET_Can_Frame_t*) &MET_Can_Protocol_RxTx_Struct.tx_message;
@@ -583,9 +1061,8 @@ void MET_Can_Application_Loop(void){
             for(i=0; i<7; i++) crc ^=  MET_Can_Protocol_RxTx_Struct.tx_message[i];
             MET_Can_Protocol_RxTx_Struct.tx_message[7] = crc;
 
-            // Sends the buffer to the caller
-            CAN0_MessageTransmit(_CAN_ID_BASE_ADDRESS + MET_Protocol_Data_Struct.deviceID, 8, MET_Can_Protocol_RxTx_Struct.tx_message, CAN_MODE_NORMAL, CAN_MSG_ATTR_TX_FIFO_DATA_FRAME);  
-            MET_Can_Protocol_Reception_Trigger(); // Reschedule the new data reception
+            // Sends the buffer to the caller and reschedules the new data reception
+            MET_Can_Protocol_Answer(_CAN_ID_BASE_ADDRESS + MET_Protocol_Data_Struct.deviceID);
             return;
             
         }
@@ -665,6 +1142,7 @@ void MET_Can_Application_Loop(void){
                 // Write data Status register
                 if( cmdFrame->idx <  MET_Protocol_Data_Struct.applicationParameterArrayLen){
                     memcpy(MET_Protocol_Data_Struct.pApplicationParameterArray[cmdFrame->idx].d, &MET_Can_Protocol_RxTx_Struct.tx_message[3], sizeof(MET_Register_t));
+                    MET_Can_Protocol_Store_Restart();
                 }else{
                      // Error index out of range
                     MET_Can_Protocol_RxTx_Struct.tx_message[1] = 0; 
@@ -674,8 +1152,17 @@ void MET_Can_Application_Loop(void){
                 break;
                 
             case MET_CAN_PROTOCOL_STORE_PARAMS:
-                for(int i=0; i< MET_Protocol_Data_Struct.applicationParameterArrayLen;i++) SmartEEPROM32[i] = *((uint32_t*) MET_Protocol_Data_Struct.pApplicationParameterArray[i].d) ;    
-                SmartEEPROM32[TEST_EEPROM_INDEX] = SMEE_CUSTOM_SIG;
+                
+                // The Command register is in use by an Application command
+                if((MET_Protocol_Data_Struct.commandRegister.status == MET_CAN_COMMAND_EXECUTING) && (!MET_Param_Store_Struct.pending)){
+                    MET_Can_Protocol_RxTx_Struct.tx_message[1] = 0; 
+                    MET_Can_Protocol_RxTx_Struct.tx_message[2] = MET_CAN_PROTOCOL_STORE_PARAMS;
+                    MET_Can_Protocol_RxTx_Struct.tx_message[3] = 2; // Busy
+                    break;
+                }
+                
+                // The registers are written in background by the MET_Can_Protocol_Loop()
+                if(MET_Protocol_Data_Struct.applicationParameterArrayLen) MET_Can_Protocol_Store_Start();
                 break;
 
             case MET_CAN_PROTOCOL_COMMAND_EXEC:
@@ -722,6 +1209,13 @@ void MET_Can_Application_Loop(void){
                     MET_Protocol_Data_Struct.commandRegister.error  = MET_CAN_COMMAND_WRONG_RETURN_CODE;                
                 }
                 
+                // An ABORT during a parameter store: the store is completed anyway
+                if(MET_Param_Store_Struct.pending){
+                    MET_Protocol_Data_Struct.commandRegister.command = MET_COMMAND_STORE_PARAMS;
+                    MET_Protocol_Data_Struct.commandRegister.status = MET_CAN_COMMAND_EXECUTING;
+                    MET_Protocol_Data_Struct.commandRegister.error = MET_CAN_COMMAND_NO_ERROR;
+                }
+                
                 memcpy(&MET_Can_Protocol_RxTx_Struct.tx_message[2], &MET_Protocol_Data_Struct.commandRegister, sizeof(MET_Command_Register_t));                                    
                 break;
             
@@ -733,9 +1227,14 @@ void MET_Can_Application_Loop(void){
         for(i=0; i<7; i++) crc ^=  MET_Can_Protocol_RxTx_Struct.tx_message[i];
         MET_Can_Protocol_RxTx_Struct.tx_message[7] = crc;
 
-        // Sends the buffer to the caller
-        CAN0_MessageTransmit(_CAN_ID_BASE_ADDRESS + MET_Protocol_Data_Struct.deviceID, 8, MET_Can_Protocol_RxTx_Struct.tx_message, CAN_MODE_NORMAL, CAN_MSG_ATTR_TX_FIFO_DATA_FRAME);  
-        MET_Can_Protocol_Reception_Trigger(); // Reschedule the new data reception
+        // Upgrades the worst reception to transmission time (the counter wraps every 65.5ms)
+        uint16_t latency = MET_CAN_TIMESTAMP() - MET_Can_Protocol_RxTx_Struct.rx_timestamp;
+        if(latency > MET_Can_Protocol_RxTx_Struct.max_latency) MET_Can_Protocol_RxTx_Struct.max_latency = latency;
+        if((rxAbortTrigger) && (latency > MET_Can_Protocol_RxTx_Struct.max_abort_answer_latency)) MET_Can_Protocol_RxTx_Struct.max_abort_answer_latency = latency;
+        rxAbortTrigger = false;
+        
+        // Sends the buffer to the caller and reschedules the new data reception
+        MET_Can_Protocol_Answer(_CAN_ID_BASE_ADDRESS + MET_Protocol_Data_Struct.deviceID);
         
     }else if(rxErrorTrigger){
         rxErrorTrigger = false;
@@ -798,9 +1297,8 @@ void MET_Can_Bootloader_Loop(void){
                 break;
         }
     
-        // Sends the buffer to the caller
-        CAN0_MessageTransmit(_CAN_ID_BOOTLOADER_ADDRESS + MET_Protocol_Data_Struct.deviceID, 8, MET_Can_Protocol_RxTx_Struct.tx_message, CAN_MODE_NORMAL, CAN_MSG_ATTR_TX_FIFO_DATA_FRAME);  
-        MET_Can_Protocol_Reception_Trigger(); // Reschedule the new data reception
+        // Sends the buffer to the caller and reschedules the new data reception
+        MET_Can_Protocol_Answer(_CAN_ID_BOOTLOADER_ADDRESS + MET_Protocol_Data_Struct.deviceID);
         
     }else if(rxBootloaderErrorTrigger){
         rxBootloaderErrorTrigger = false;
@@ -828,7 +1326,7 @@ void MET_Can_Bootloader_Loop(void){
  * 
  * @param context
  */
-void MET_Can_Protocol_Reception_Callback(uintptr_t context)
+void HOT_CODE MET_Can_Protocol_Reception_Callback(uintptr_t context)
 {
  
      uint32_t  status = CAN0_ErrorGet();
@@ -836,7 +1334,10 @@ void MET_Can_Protocol_Reception_Callback(uintptr_t context)
     if (((status & CAN_PSR_LEC_Msk) == CAN_ERROR_NONE) || ((status & CAN_PSR_LEC_Msk) == CAN_ERROR_LEC_NC))
     {
         
-       if(MET_Can_Protocol_RxTx_Struct.rx_messageID >= _CAN_ID_BASE_ADDRESS)   rxReceptionTrigger = true;
+       if(MET_Can_Protocol_RxTx_Struct.rx_messageID >= _CAN_ID_BASE_ADDRESS){
+           rxReceptionTrigger = true;
+           MET_Can_Protocol_Abort_Detect();
+       }
        else rxBootloaderReceptionTrigger = true;
        
     }    else 
@@ -847,6 +1348,40 @@ void MET_Can_Protocol_Reception_Callback(uintptr_t context)
     }
 }
 
+/**
+ * @brief ABORT fast path
+ * 
+ * This function is called by the reception interrupt for every Application frame.
+ * 
+ * If the frame is a valid ABORT command frame (8 byte, CRC, new sequence number)
+ * the Application abort callback is called immediately, 
+ * without waiting for the main loop to process the frame:
+ * the frame is then processed as usual by the MET_Can_Application_Loop(),
+ * and the Application command handler returns the protocol answer.
+ * 
+ * The time from the frame reception to the callback completion is measured
+ * (see MET_Can_Protocol_GetMaxAbortLatency()).
+ */
+void HOT_CODE MET_Can_Protocol_Abort_Detect(void){
+    MET_Can_Frame_t* cmdFrame = (MET_Can_Frame_t*) &MET_Can_Protocol_RxTx_Struct.rx_message;
+    uint8_t crc = 0;
+    uint8_t i;
+    
+    if(MET_Protocol_Data_Struct.applicationAbortHandler == 0) return;
+    if(MET_Can_Protocol_RxTx_Struct.rx_messageLength != 8) return;
+    if((cmdFrame->frame_cmd != MET_CAN_PROTOCOL_COMMAND_EXEC) || (cmdFrame->idx != MET_COMMAND_ABORT)) return;
+    if(cmdFrame->seq == rxLastSequence) return;
+    
+    for(i=0; i<8; i++) crc ^=  MET_Can_Protocol_RxTx_Struct.rx_message[i];
+    if(crc) return;
+    
+    MET_Protocol_Data_Struct.applicationAbortHandler();
+    rxAbortTrigger = true;
+    
+    uint16_t latency = MET_CAN_TIMESTAMP() - MET_Can_Protocol_RxTx_Struct.rx_timestamp;
+    if(latency > MET_Can_Protocol_RxTx_Struct.max_abort_latency) MET_Can_Protocol_RxTx_Struct.max_abort_latency = latency;
+}
+
 /**
  * @brief Module Error Handler
  * 
@@ -861,13 +1396,81 @@ void MET_DefaultError_Callback(uint8_t errEvent)
             break;
     }
     
+    // Notifies the Application (the function can be called in interrupt context)
+    if(MET_Protocol_Data_Struct.applicationErrorHandler) MET_Protocol_Data_Struct.applicationErrorHandler(errEvent);
     return;
 }
 
+/**
+ * This function registers an Application callback 
+ * called every time the module detects a protocol error.
+ * 
+ * \note The callback can be called in the CAN interrupt context.
+ * 
+ * @param pErrorHandler Application error callback or 0 to disable the notification
+ */
+void MET_Can_Protocol_SetErrorHandler(MET_errorHandler_t pErrorHandler){
+    MET_Protocol_Data_Struct.applicationErrorHandler = pErrorHandler;
+}
+
+/**
+ * This function registers an Application callback 
+ * called after the PARAMETER registers have been stored
+ * into the SmartEEPROM with the STORE_PARAMS frame.
+ * 
+ * The callback is called in the main loop context (MET_Can_Protocol_Loop()).
+ * 
+ * @param pParamHandler Application callback or 0 to disable the notification
+ */
+void MET_Can_Protocol_SetParamHandler(MET_paramHandler_t pParamHandler){
+    MET_Protocol_Data_Struct.applicationParamHandler = pParamHandler;
+}
+
+/**
+ * This function registers an Application callback 
+ * called as soon as an ABORT command frame is received.
+ * 
+ * The callback is called in the CAN interrupt context, before the frame
+ * is processed by the main loop: it shall only stop the activities 
+ * (for example the motor drivers), leaving the protocol answer 
+ * to the Application command handler (MET_COMMAND_ABORT).
+ * 
+ * @param pAbortHandler Application callback or 0 to disable the fast path
+ */
+void MET_Can_Protocol_SetAbortHandler(MET_abortHandler_t pAbortHandler){
+    MET_Protocol_Data_Struct.applicationAbortHandler = pAbortHandler;
+}
+
+/**
+ * This function sends a 8 byte Application stream frame 
+ * on the CAN Id _CAN_ID_STREAM_BASE_ADDRESS + Device Id.
+ * 
+ * The stream frames are not part of the register protocol:
+ * they are used to transfer bulk data to the remote device.
+ * 
+ * The frame is queued only if a TX FIFO element is free and no protocol
+ * request is waiting to be answered: the TX FIFO can have a single element
+ * (TXBC.TFQS = 1 in the FW325 configuration).
+ * A request received while the stream frame is on the bus
+ * is answered as soon as the element is free (see MET_Can_Protocol_Answer()),
+ * so the answer is delayed by one frame time at most.
+ * 
+ * @param data pointer to the 8 byte frame content
+ * @return true if the frame has been queued
+ */
+bool MET_Can_Protocol_SendStream(uint8_t* data){
+    if(txAnswerPending || rxReceptionTrigger || rxBootloaderReceptionTrigger) return false;
+    if(MET_CAN_TX_FIFO_FREE() == 0) return false;
+    return MET_Can_Transmit(_CAN_ID_STREAM_BASE_ADDRESS + MET_Protocol_Data_Struct.deviceID, data);
+}
+
 
 void MET_Can_AppRestartCallback(uintptr_t contextHandle){
     if( !MET_Protocol_Data_Struct.appreset_request) return;
     
+    // Completion of a previous frame: the START answer is not yet on the bus
+    if(txAnswerPending) return;
+    
     MET_Protocol_Data_Struct.appreset_request = false;
     MET_Protocol_Data_Struct.pBootRam->activation_code0 = _BOOT_ACTIVATION_CODE_START0;
     MET_Protocol_Data_Struct.pBootRam->activation_code1 = _BOOT_ACTIVATION_CODE_START1;
@@ -877,85 +1480,292 @@ void MET_Can_AppRestartCallback(uintptr_t contextHandle){
     return;
 }
 
-// This section activates the bridge from channel 0 to channel 1 on the FIFO1 reception 
-#ifdef _MET_MOTOR_BRIDGE_
+/**
+ * This function sends the protocol answer prepared in the tx_message buffer.
+ * 
+ * If the TX FIFO is full (a stream frame is still on the bus)
+ * the answer is kept pending and retried by MET_Can_Protocol_Loop():
+ * the reception is rearmed only after the answer has been queued,
+ * so the buffer cannot be overwritten by a further request.
+ * 
+ * @param id frame ID of the answer
+ */
+void MET_Can_Protocol_Answer(uint32_t id){
+    if(!MET_Can_Transmit(id, MET_Can_Protocol_RxTx_Struct.tx_message)){
+        txAnswerPending = true;
+        txAnswerId = id;
+        return;
+    }
+    
+    txAnswerPending = false;
+    MET_Can_Protocol_Reception_Trigger(); // Reschedule the new data reception
+}
 
-static MET_Can_Protocol_RxTx_t MET_CanBridge0_RxTx_Struct; //!< This is the structure handling the data transmitted and received
-static MET_Can_Protocol_RxTx_t MET_CanBridge1_RxTx_Struct; //!< This is the structure handling the data transmitted and received
+/**
+ * This function transmits a 8 byte frame on CAN0 from the main loop.
+ * 
+ * With the Motor Bridge the CAN1 interrupt transmits on CAN0 too:
+ * the TX FIFO element is reserved and filled with the interrupts disabled.
+ * 
+ * @param id frame ID
+ * @param data pointer to the 8 byte frame content
+ * @return true if the frame has been queued into the TX FIFO
+ */
+bool MET_Can_Transmit(uint32_t id, uint8_t* data){
+#ifdef _MET_MOTOR_BRIDGE_
+    uint32_t primask = __get_PRIMASK();
+    __disable_irq();
+    bool queued = CAN0_MessageTransmit(id, 8, data, CAN_MODE_NORMAL, CAN_MSG_ATTR_TX_FIFO_DATA_FRAME);
+    __set_PRIMASK(primask);
+    return queued;
+#else
+    return CAN0_MessageTransmit(id, 8, data, CAN_MODE_NORMAL, CAN_MSG_ATTR_TX_FIFO_DATA_FRAME);
+#endif
+}
 
-uint8_t Can1MessageRAM[CAN1_MESSAGE_RAM_CONFIG_SIZE] __attribute__((aligned (32)));
+// This section activates the bridge between CAN0 (RX FIFO 1) and CAN1 (RX FIFO 0)
+#ifdef _MET_MOTOR_BRIDGE_
 
-CAN_MSG_RX_FRAME_ATTRIBUTE msgFrameAttr1 = CAN_MSG_RX_DATA_FRAME; 
+#define MET_CAN_BRIDGE_QUEUE_MASK       (MET_CAN_BRIDGE_QUEUE_SIZE - 1) //!< Queue index mask
+#define MET_CAN_BRIDGE_RX_ELEMENT_SIZE  16U //!< Size of a RX FIFO element (8 data bytes)
+#define MET_CAN_BRIDGE_STD_ID_MSK       0x7FFU //!< Standard frame ID mask (ID[28:18] of the RX FIFO element)
+#define MET_CAN_BRIDGE_CAN0_FIFO1_SIZE  16U //!< Elements of the CAN0 RX FIFO 1
+#define MET_CAN_BRIDGE_CAN0_FILTERS     2U  //!< Standard filters added to the CAN0 list (RX FIFO 1)
+#define MET_CAN_BRIDGE_CAN0_FILTER_LIST ((CAN0_STD_MSG_ID_FILTER_SIZE / 4U) + MET_CAN_BRIDGE_CAN0_FILTERS) //!< Size of the CAN0 filter list
 
-/// Interrupt routine
-static void MET_CanBridge0_Reception_Callback(uintptr_t context);         
-static void MET_CanBridge1_Reception_Callback(uintptr_t context);         
-        
-/// Reception activation routine
-static void MET_CanBridge0_Reception_Trigger(void);     
-static void MET_CanBridge1_Reception_Trigger(void);     
+/// Bridged frame
+typedef struct {
+    uint32_t id;        //!< Frame ID (11 or 29 bit)
+    uint8_t length;     //!< Data length
+    uint8_t data[8];    //!< Data bytes
+} MET_CanBridge_Frame_t;
 
-void MET_CanBridge0_Reception_Trigger(void){
+/// Harmony 3 transmit function of a CAN module
+typedef bool (*MET_CanBridge_Transmit_t)(uint32_t id, uint8_t length, uint8_t* data, CAN_MODE mode, CAN_MSG_TX_ATTRIBUTE msgAttr);
 
-    // Reception Event callback registered on the FIFO0
-    CAN0_RxCallbackRegister( MET_CanBridge0_Reception_Callback, 0 , CAN_MSG_ATTR_RX_FIFO1 );
+/**
+ * @brief Bridge direction data
+ * 
+ * The queue is a ring of frames: head and tail are free running indexes
+ * (the queue level is head - tail). The frames are pushed and pulled
+ * only in the CAN interrupts (same priority).
+ */
+typedef struct {
+    can_registers_t* rx_regs;           //!< Receiving CAN module
+    bool rx_fifo1;                      //!< The frames are received on the RX FIFO 1 (RX FIFO 0 otherwise)
+    can_registers_t* tx_regs;           //!< Destination CAN module
+    MET_CanBridge_Transmit_t transmit;  //!< Destination module transmission
     
-    // Activate the reception buffer on the FIFO-0
-    if (CAN0_MessageReceive(&MET_CanBridge0_RxTx_Struct.rx_messageID,
-            &MET_CanBridge0_RxTx_Struct.rx_messageLength,
-            MET_CanBridge0_RxTx_Struct.rx_message,
-            &MET_CanBridge0_RxTx_Struct.rx_timestamp,
-            CAN_MSG_ATTR_RX_FIFO1, &msgFrameAttr0) == false)  MET_DefaultError_Callback(MET_CAN_PROTOCOL_ERROR_RECEPTION_ACTIVATION);
+    MET_CanBridge_Frame_t queue[MET_CAN_BRIDGE_QUEUE_SIZE]; //!< Frames to be forwarded
+    uint8_t head;                       //!< Next frame to be pushed
+    uint8_t tail;                       //!< Next frame to be forwarded
     
-    return;
+    MET_CanBridge_Counters_t counters;  //!< Direction counters
+} MET_CanBridge_t;
+
+uint8_t Can1MessageRAM[CAN1_MESSAGE_RAM_CONFIG_SIZE] __attribute__((aligned (32)));
+static uint8_t MET_CanBridge_Can0Fifo1RAM[MET_CAN_BRIDGE_CAN0_FIFO1_SIZE * MET_CAN_BRIDGE_RX_ELEMENT_SIZE] __attribute__((aligned (32))); //!< CAN0 RX FIFO 1 elements
+static uint32_t MET_CanBridge_Can0Filters[MET_CAN_BRIDGE_CAN0_FILTER_LIST] __attribute__((aligned (32))); //!< CAN0 standard filter list
+
+/// Bridge directions
+static MET_CanBridge_t MET_CanBridge[MET_CAN_BRIDGE_DIRECTIONS] = {
+    [MET_CAN_BRIDGE_CAN0_TO_CAN1] = { .rx_regs = CAN0_REGS, .rx_fifo1 = true, .tx_regs = CAN1_REGS, .transmit = CAN1_MessageTransmit },
+    [MET_CAN_BRIDGE_CAN1_TO_CAN0] = { .rx_regs = CAN1_REGS, .rx_fifo1 = false, .tx_regs = CAN0_REGS, .transmit = CAN0_MessageTransmit },
+};
+
+/// Returns the number of frames into the queue
+static inline uint8_t MET_CanBridge_Level(MET_CanBridge_t* bridge){
+    return (uint8_t) (bridge->head - bridge->tail);
 }
 
-void MET_CanBridge1_Reception_Trigger(void){
+/**
+ * This function forwards the queued frames to the destination module
+ * until the destination TX FIFO is full.
+ * 
+ * The frames are discarded (drops) while the destination module is in bus-off.
+ */
+static void MET_CanBridge_Forward(MET_CanBridge_t* bridge){
+    while(bridge->tail != bridge->head){
+        MET_CanBridge_Frame_t* frame = &bridge->queue[bridge->tail & MET_CAN_BRIDGE_QUEUE_MASK];
+        
+        if(bridge->tx_regs->CAN_PSR & CAN_PSR_BO_Msk){
+            if(bridge->counters.drops < 0xFFFF) bridge->counters.drops++;
+        }else if(bridge->transmit(frame->id, frame->length, frame->data, CAN_MODE_NORMAL, CAN_MSG_ATTR_TX_FIFO_DATA_FRAME)){
+            bridge->counters.forwarded++;
+        }else break; // TX FIFO full: forwarded at the transmission completed interrupt
+        
+        bridge->tail++;
+    }
+}
 
-    // Reception Event callback registered on the FIFO0
-    CAN1_RxCallbackRegister( MET_CanBridge1_Reception_Callback, 0 , CAN_MSG_ATTR_RX_FIFO0 );
+/**
+ * This function serves a bridge direction.
+ * 
+ * The RX FIFO of the direction is owned by the bridge (no Harmony 3 reception):
+ * the frames are read directly from the message RAM, queued and acknowledged
+ * until the FIFO is empty, then the queue is forwarded to the destination module.
+ * The new frame flag is cleared before every test of the FIFO fill level,
+ * so a frame received after the test raises the interrupt again.
+ * 
+ * With a full queue the frames are not acknowledged and the new frame 
+ * interrupt is disabled (back-pressure): the frames wait into the RX FIFO
+ * and they are read when the destination transmission completed interrupt 
+ * serves the direction again. A frame is lost only when the RX FIFO 
+ * is full too (RX FIFO message lost event, counted as overrun).
+ * 
+ * The function is called by every interrupt of both the CAN modules.
+ */
+static void MET_CanBridge_Serve(MET_CanBridge_t* bridge){
+    can_registers_t* can = bridge->rx_regs;
+    bool fifo1 = bridge->rx_fifo1;
+    uint32_t lost = (fifo1) ? CAN_IR_RF1L_Msk : CAN_IR_RF0L_Msk;
+    uint32_t received = (fifo1) ? CAN_IR_RF1N_Msk : CAN_IR_RF0N_Msk;
+    uint32_t received_ie = (fifo1) ? CAN_IE_RF1NE_Msk : CAN_IE_RF0NE_Msk;
     
-    // Activate the reception buffer on the FIFO-0
-    if (CAN1_MessageReceive(&MET_CanBridge1_RxTx_Struct.rx_messageID,
-            &MET_CanBridge1_RxTx_Struct.rx_messageLength,
-            MET_CanBridge1_RxTx_Struct.rx_message,
-            &MET_CanBridge1_RxTx_Struct.rx_timestamp,
-            CAN_MSG_ATTR_RX_FIFO0, &msgFrameAttr1) == false)  MET_DefaultError_Callback(MET_CAN_PROTOCOL_ERROR_RECEPTION_ACTIVATION);
+    if(can->CAN_IR & lost){
+        can->CAN_IR = lost;
+        if(bridge->counters.overruns < 0xFFFF) bridge->counters.overruns++;
+    }
     
-    return;
+    MET_CanBridge_Forward(bridge);
+    
+    while(MET_CanBridge_Level(bridge) < MET_CAN_BRIDGE_QUEUE_SIZE){
+        can->CAN_IR = received;
+        
+        // RX FIFO 0 and RX FIFO 1 registers have the same layout
+        uint32_t status = (fifo1) ? can->CAN_RXF1S : can->CAN_RXF0S;
+        if((status & CAN_RXF0S_F0FL_Msk) == 0) break;
+        
+        uint32_t gi = (status & CAN_RXF0S_F0GI_Msk) >> CAN_RXF0S_F0GI_Pos;
+        uint32_t sa = ((fifo1) ? can->CAN_RXF1C : can->CAN_RXF0C) & CAN_RXF0C_F0SA_Msk;
+        can_rxf0e_registers_t* element = (can_rxf0e_registers_t*) (HSRAM_ADDR + sa + gi * MET_CAN_BRIDGE_RX_ELEMENT_SIZE);
+        MET_CanBridge_Frame_t* frame = &bridge->queue[bridge->head & MET_CAN_BRIDGE_QUEUE_MASK];
+        uint32_t r0 = element->CAN_RXF0E_0;
+        uint8_t dlc = (uint8_t) ((element->CAN_RXF0E_1 & CAN_RXF0E_1_DLC_Msk) >> CAN_RXF0E_1_DLC_Pos);
+        
+        frame->id = (r0 & CAN_RXF0E_0_XTD_Msk) ? (r0 & CAN_RXF0E_0_ID_Msk) : ((r0 >> 18) & MET_CAN_BRIDGE_STD_ID_MSK);
+        frame->length = (dlc > 8) ? 8 : dlc;
+        memcpy(frame->data, (uint8_t*) &element->CAN_RXF0E_DATA, 8);
+        
+        if(fifo1) can->CAN_RXF1A = CAN_RXF1A_F1AI(gi);
+        else can->CAN_RXF0A = CAN_RXF0A_F0AI(gi);
+        
+        bridge->head++;
+        if(MET_CanBridge_Level(bridge) > bridge->counters.max_level) bridge->counters.max_level = MET_CanBridge_Level(bridge);
+        
+        // The queue is full: the TX FIFO may have room in the meantime
+        if(MET_CanBridge_Level(bridge) >= MET_CAN_BRIDGE_QUEUE_SIZE) MET_CanBridge_Forward(bridge);
+    }
+    
+    MET_CanBridge_Forward(bridge);
+    
+    // Back-pressure: the frames wait into the RX FIFO until the queue has room
+    if(MET_CanBridge_Level(bridge) >= MET_CAN_BRIDGE_QUEUE_SIZE) can->CAN_IE &= ~received_ie;
+    else can->CAN_IE |= received_ie;
+}
+
+/**
+ * This function configures the CAN0 RX FIFO 1 of the bridge.
+ * 
+ * The Harmony 3 CAN0 configuration has not the RX FIFO 1 
+ * (its interrupt handler would read the FIFO): the FIFO elements 
+ * are allocated here and the bridge filters are appended 
+ * to the Harmony 3 standard filter list:
+ * + ID 0 (NMT) to RX FIFO 1;
+ * + ID 0x603 to 0x607 (SDO requests of the motor drivers) to RX FIFO 1.
+ * 
+ * The FIFO works in blocking mode: with the FIFO full the new frames are lost
+ * and the RX FIFO message lost event is signaled.
+ */
+static void MET_CanBridge_Can0Fifo1Config(void){
+    uint32_t sidfc = CAN0_REGS->CAN_SIDFC;
+    uint32_t lss = (sidfc & CAN_SIDFC_LSS_Msk) >> CAN_SIDFC_LSS_Pos;
+    const uint32_t* list = (const uint32_t*) (HSRAM_ADDR + (sidfc & CAN_SIDFC_FLSSA_Msk));
+    
+    if(lss > MET_CAN_BRIDGE_CAN0_FILTER_LIST - MET_CAN_BRIDGE_CAN0_FILTERS) lss = MET_CAN_BRIDGE_CAN0_FILTER_LIST - MET_CAN_BRIDGE_CAN0_FILTERS;
+    for(uint32_t i = 0; i < lss; i++) MET_CanBridge_Can0Filters[i] = list[i];
+    MET_CanBridge_Can0Filters[lss++] = CAN_SIDFE_0_SFT(CAN_SIDFE_0_SFT_RANGE_Val) | CAN_SIDFE_0_SFEC_STF1M | CAN_SIDFE_0_SFID1(0U) | CAN_SIDFE_0_SFID2(0U);
+    MET_CanBridge_Can0Filters[lss++] = CAN_SIDFE_0_SFT(CAN_SIDFE_0_SFT_RANGE_Val) | CAN_SIDFE_0_SFEC_STF1M | CAN_SIDFE_0_SFID1(0x603U) | CAN_SIDFE_0_SFID2(0x607U);
+    
+    // Configuration change: the module is set in the initialization state
+    CAN0_REGS->CAN_CCCR |= CAN_CCCR_INIT_Msk;
+    while((CAN0_REGS->CAN_CCCR & CAN_CCCR_INIT_Msk) == 0);
+    CAN0_REGS->CAN_CCCR |= CAN_CCCR_CCE_Msk;
+    
+    CAN0_REGS->CAN_RXF1C = CAN_RXF1C_F1S(MET_CAN_BRIDGE_CAN0_FIFO1_SIZE) | CAN_RXF1C_F1SA((uint32_t) MET_CanBridge_Can0Fifo1RAM);
+    CAN0_REGS->CAN_SIDFC = CAN_SIDFC_LSS(lss) | CAN_SIDFC_FLSSA((uint32_t) MET_CanBridge_Can0Filters);
+    
+    CAN0_REGS->CAN_CCCR &= ~CAN_CCCR_INIT_Msk;
+    while((CAN0_REGS->CAN_CCCR & CAN_CCCR_INIT_Msk) != 0);
 }
 
 void MET_InitCanBridge(void){
-    MET_CanBridge0_Reception_Trigger();
-    MET_CanBridge1_Reception_Trigger();    
+    // Harmony 3 library call: Init memory of the CAN Bus module
+    CAN1_MessageRAMConfigSet(Can1MessageRAM);
+    MET_CanBridge_Can0Fifo1Config();
+    
+    // CAN1 interrupt (owned by the bridge, see CAN1_Handler()): 
+    // RX FIFO 0 new frame, transmission completed of every TX buffer and bus-off
+    CAN1_REGS->CAN_TXBTIE = CAN_TXBTIE_Msk;
+    CAN1_REGS->CAN_IE = CAN_IE_RF0NE_Msk | CAN_IE_TCE_Msk | CAN_IE_BOE_Msk;
+    CAN1_REGS->CAN_ILE = CAN_ILE_EINT0_Msk;
+    NVIC_SetPriority(CAN1_IRQn, NVIC_GetPriority(CAN0_IRQn));
+    NVIC_EnableIRQ(CAN1_IRQn);
+    
+    // First service of both the directions: it enables the new frame interrupts
+    uint32_t primask = __get_PRIMASK();
+    __disable_irq();
+    MET_CanBridge_Serve(&MET_CanBridge[MET_CAN_BRIDGE_CAN0_TO_CAN1]);
+    MET_CanBridge_Serve(&MET_CanBridge[MET_CAN_BRIDGE_CAN1_TO_CAN0]);
+    __set_PRIMASK(primask);
 }
 
-void MET_CanBridge0_Reception_Callback(uintptr_t context)
+/**
+ * @brief CAN0 interrupt with the Motor Bridge
+ * 
+ * The RX FIFO 1 (CAN0 to CAN1 direction) is served before the Harmony 3 handler,
+ * that handles the protocol RX FIFO 0 and the CAN0 transmissions;
+ * the CAN1 to CAN0 direction is served after it, when the CAN0 TX FIFO can have room.
+ */
+void CAN0_Handler(void)
 {
- 
-    uint32_t  status = CAN1_ErrorGet();
-
-    if (((status & CAN_PSR_LEC_Msk) == CAN_ERROR_NONE) || 
-	((status & CAN_PSR_LEC_Msk) == CAN_ERROR_LEC_NC))
-    {
-        CAN1_MessageTransmit(MET_CanBridge0_RxTx_Struct.rx_messageID, MET_CanBridge0_RxTx_Struct.rx_messageLength, MET_CanBridge0_RxTx_Struct.rx_message, CAN_MODE_NORMAL, CAN_MSG_ATTR_TX_FIFO_DATA_FRAME);          
-    }     
-    
-    MET_CanBridge0_Reception_Trigger();  
+    MET_CanBridge_Serve(&MET_CanBridge[MET_CAN_BRIDGE_CAN0_TO_CAN1]);
+    CAN0_InterruptHandler();
+    MET_CanBridge_Serve(&MET_CanBridge[MET_CAN_BRIDGE_CAN1_TO_CAN0]);
 }
 
-void MET_CanBridge1_Reception_Callback(uintptr_t context)
+/**
+ * @brief CAN1 interrupt
+ * 
+ * The CAN1 module is used only by the bridge: the Harmony 3 CAN1 library 
+ * is configured without interrupt and this handler serves both the directions
+ * (CAN1 RX FIFO 0 reception and CAN1 transmission completed).
+ */
+void CAN1_Handler(void)
 {
- 
-    uint32_t  status = CAN1_ErrorGet();
+    uint32_t ir = CAN1_REGS->CAN_IR;
+    
+    CAN1_REGS->CAN_IR = ir & (CAN_IR_TC_Msk | CAN_IR_BO_Msk);
+    MET_CanBridge_Serve(&MET_CanBridge[MET_CAN_BRIDGE_CAN1_TO_CAN0]);
+    MET_CanBridge_Serve(&MET_CanBridge[MET_CAN_BRIDGE_CAN0_TO_CAN1]);
+}
 
-    if (((status & CAN_PSR_LEC_Msk) == CAN_ERROR_NONE) || 
-	((status & CAN_PSR_LEC_Msk) == CAN_ERROR_LEC_NC))
-    {
-        CAN0_MessageTransmit(MET_CanBridge1_RxTx_Struct.rx_messageID, MET_CanBridge1_RxTx_Struct.rx_messageLength, MET_CanBridge1_RxTx_Struct.rx_message, CAN_MODE_NORMAL, CAN_MSG_ATTR_TX_FIFO_DATA_FRAME);          
-    }     
+/**
+ * This function returns the Motor Bridge counters of a direction.
+ * 
+ * @param direction bridge direction
+ * @param counters counters copy
+ */
+void MET_Can_Bridge_GetCounters(MET_CAN_BRIDGE_DIRECTION_t direction, MET_CanBridge_Counters_t* counters){
+    if(direction >= MET_CAN_BRIDGE_DIRECTIONS){
+        memset(counters, 0, sizeof(MET_CanBridge_Counters_t));
+        return;
+    }
     
-    MET_CanBridge1_Reception_Trigger();  
+    uint32_t primask = __get_PRIMASK();
+    __disable_irq();
+    *counters = MET_CanBridge[direction].counters;
+    __set_PRIMASK(primask);
 }
 
 #else
@@ -964,6 +1774,11 @@ void MET_InitCanBridge(void){
     return;
 }
 
+void MET_Can_Bridge_GetCounters(MET_CAN_BRIDGE_DIRECTION_t direction, MET_CanBridge_Counters_t* counters){
+    (void) direction;
+    memset(counters, 0, sizeof(MET_CanBridge_Counters_t));
+}
+
 #endif
 
 /** @}*/  // metCanLocal
\ No newline at end of file
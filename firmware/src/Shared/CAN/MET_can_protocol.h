@@ -97,16 +97,14 @@
  *   + RX FIFO 0 Setting
  *      + Number of element: 1
  * 
- * + Use RX FIFO 1: Yes
- *   + RX FIFO 1 Setting
- *      + Number of element: 16
+ * + Use RX FIFO 1: No (with the Motor Bridge it is configured by MET_InitCanBridge())
  * 
  * + Use TX FIFO: Yes
  *   + TX FIFO Setting
  *      + Number of element: 16 
  * 
  * + Standard Filters 
- *  + Number Of STandard Filters: 4
+ *  + Number Of STandard Filters: 2
  * 
  *  + Standard Filter 1
  *      + Type: Range;
@@ -120,31 +118,21 @@
  *      + ID2: 0x100 + Device ID 
  *      + Element Configuration: Store in RX FIFO 0
  * 
- *  + Standard Filter 3
- *      + Type: Range;
- *      + ID1: 0  
- *      + ID2: 0 
- *      + Element Configuration: Store in RX FIFO 1
- * 
- *  + Standard Filter 4
- *      + Type: Range;
- *      + ID1: 0x603  
- *      + ID2: 0x607
- *      + Element Configuration: Store in RX FIFO 1
-
  *  + Reject Standard Remote Frames: YES
  * 
  *  + Timestamp Enable: YES 
  * 
  * ```
  *
+ * With the Motor Bridge MET_InitCanBridge() adds the RX FIFO 1 (16 elements)
+ * and two standard filters to RX FIFO 1: ID 0 and ID 0x603 to 0x607.
  * 
  *  * ## CAN1 configuration (for Motor Bridge only)
  * 
  * ```text
  * 
  * + CAN Operational Mode = NORMAL;
- * + Interrupt Mode: Yes;
+ * + Interrupt Mode: No (the CAN1 interrupt is owned by the bridge);
  * + Bit Timing Calculation
  *  + Nominal Bit Timing
  *      + Automatic Nominal Bit Timing: Yes;
@@ -152,7 +140,7 @@
  * 
  * + Use RX FIFO 0: Yes
  *   + RX FIFO 0 Setting
- *      + Number of element: 1
+ *      + Number of element: 16
  * 
  * + Use RX FIFO 1: No
  * 
@@ -208,14 +196,20 @@
  *      + MET_Can_Protocol_TestErrors(): test a condition on a ERRORS register mask;
  *
  *  
- *  + Functions to Test the Application DATA registers:
+ *  + Functions to Get/Set the Application DATA registers:
  *      + MET_Can_Protocol_GetData(): returns a byte value of a DATA register;
  *      + MET_Can_Protocol_TestData(): test a condition on a DATA register mask;
+ *      + MET_Can_Protocol_SetDataReg(): sets a byte of a DATA register (Application published data);
  *
  *  + Functions to Test the Application PARAMETER registers:
  *      + MET_Can_Protocol_GetParameter(): returns a byte value of a PARAMETER register;
  *      + MET_Can_Protocol_TestParameter(): test a condition on a PARAMETER register mask;
  * 
+ *  + Functions to monitor the PARAMETER storage:
+ *      + MET_Can_Protocol_IsStorePending(): a STORE_PARAMS is in progress;
+ *      + MET_Can_Protocol_GetStoreWrites(): SmartEEPROM words written since the first store (wear counter);
+ *      + MET_Can_Protocol_GetStoreReallocations(): SmartEEPROM sector reallocations since the startup;
+ * 
  * 
  *  + Functions to handle the Command Execution:
  *      + MET_Can_Protocol_getCommandCode(): return the requested command code;
@@ -224,7 +218,67 @@
  *      + MET_Can_Protocol_getCommandParam2(): requests for the command parameter 2;
  *      + MET_Can_Protocol_getCommandParam3(): requests for the command parameter 3;
  *      + MET_Can_Protocol_setReturnCommand(): set the return code should be returned after the command handling.
- * 
+ *
+ *  # Parameter Storage
+ *
+ *  The PARAMETER registers are stored into the SmartEEPROM as a parameter image
+ *  (up to \ref MET_EEPROM_IMAGE_WORDS registers) made of:
+ *  + a descriptor word: tag, layout version and number of registers;
+ *  + a sequence number, incremented at every store;
+ *  + a CRC32 of the descriptor, sequence number and register words;
+ *  + the register words.
+ *
+ *  The SmartEEPROM holds two image slots (A and B): a store is always written into
+ *  the slot not holding the last good image and the CRC32 word is written last,
+ *  so a power loss during a store leaves the last good image untouched.
+ *  At the startup the whole SmartEEPROM is read with a single NVMCTRL_Read() and the valid
+ *  image with the greatest sequence number is loaded (the single copy stored by the
+ *  previous revisions is loaded if no image is present).
+ *
+ *  The STORE_PARAMS frame is answered immediately: the image is written
+ *  in background by the MET_Can_Protocol_Loop():
+ *  + nothing is written if the registers match the last good image;
+ *  + only the words different from the target slot content are written (one word per loop);
+ *  + up to \ref MET_EEPROM_STORE_SCAN registers are compared in a loop;
+ *  + nothing is done while the SmartEEPROM is busy;
+ *  + a full active sector is reallocated before to proceed.
+ *
+ *  During the store the Command register reports the \ref MET_COMMAND_STORE_PARAMS command code:
+ *  + status EXECUTING while the store is in progress (the COMMAND_EXEC frames are refused with BUSY error,
+ *    the ABORT command is passed to the Application but the store is completed anyway);
+ *  + status EXECUTED at the end, with result[0:1] = number of written words.
+ *
+ *  A STORE_PARAMS frame or a PARAMETER change received during the store
+ *  restarts the comparison from the first register (the writes are coalesced).
+ *  The STORE_PARAMS frame received while an Application command is executing
+ *  is refused (answer data byte 1 = 0, byte 3 = 2: busy).
+ *
+ *  The total number of written words is kept into the SmartEEPROM
+ *  for the wear monitoring (MET_Can_Protocol_GetStoreWrites()).
+ *
+ *  # Motor Bridge
+ *
+ *  With the _MET_MOTOR_BRIDGE_ define the module forwards the frames
+ *  received on CAN0 RX FIFO 1 to CAN1 and the frames received on CAN1 RX FIFO 0 to CAN0,
+ *  entirely in the CAN interrupts:
+ *  + both the RX FIFOs are owned by the bridge: the frames are read directly
+ *    from the message RAM (no Harmony reception), MET_InitCanBridge() configures
+ *    the CAN0 RX FIFO 1 and the CAN1 interrupt;
+ *  + every direction has a queue of \ref MET_CAN_BRIDGE_QUEUE_SIZE frames;
+ *  + the reception interrupt drains all the frames of the RX FIFO into the queue;
+ *  + the queue is forwarded until the destination TX FIFO is full:
+ *    the remaining frames are forwarded by the destination transmission completed interrupt;
+ *  + with a full queue the frames are not acknowledged and the new frame interrupt
+ *    is disabled (back-pressure): the frames wait into the RX FIFO and they are 
+ *    read by the transmission completed interrupt of the destination module.
+ *
+ *  A frame is lost only when the RX FIFO is full too (overruns);
+ *  the overruns and the frames discarded because the destination channel 
+ *  is in bus-off (drops) are counted for every direction (MET_Can_Bridge_GetCounters()).
+ *
+ *  The CAN0 and CAN1 interrupts shall have the same priority (the queues are shared);
+ *  the module transmissions from the main loop on CAN0 are executed
+ *  with the interrupts disabled, because the bridge transmits on CAN0 in the CAN1 interrupt.
  *
  *    @{
  * 
@@ -246,7 +300,13 @@
 
         #define _CAN_ID_BASE_ADDRESS 0x140 //!< This is the base address for the communication point to point
         #define _CAN_ID_BOOTLOADER_ADDRESS 0x100 //!< This is the base address for the Loader frames
+        #define _CAN_ID_STREAM_BASE_ADDRESS 0x180 //!< This is the base address for the Application stream frames
+        #ifndef MET_CAN_BRIDGE_QUEUE_SIZE
+        #define MET_CAN_BRIDGE_QUEUE_SIZE 32 //!< Frames of a Motor Bridge direction queue (power of 2, max 128)
+        #endif
+        #ifndef _BOOTLOADER_SHARED_RAM
         #define _BOOTLOADER_SHARED_RAM   0x20000000 //!< RAM shared start address
+        #endif
 
 
         #define _BOOT_ACTIVATION_CODE_PRESENCE0  0x11 //!< Code 0 Bootloader presence
@@ -260,6 +320,10 @@
         #define _BOOT_ACTIVATION_CODE_START3  0x4 //!< Code 3 Bootloader start
 
         #define MET_COMMAND_ABORT 0 //!< This is the reserved command code for the ABORT command
+        #define MET_COMMAND_STORE_PARAMS 0xFF //!< This is the reserved command code reporting the STORE_PARAMS execution
+        
+        #define MET_EEPROM_STORE_SCAN 32 //!< Max PARAMETER registers compared with the SmartEEPROM in a main loop slice
+        #define MET_EEPROM_IMAGE_WORDS 121 //!< Max PARAMETER registers stored into the SmartEEPROM (capacity of an image slot)
 
     /** @}*/  // metCanConstants
 
@@ -413,6 +477,15 @@
          */       
         typedef void (*MET_commandHandler_t)(uint8_t cmd, uint8_t d0, uint8_t d1, uint8_t d2, uint8_t d3);
         
+        /// Protocol error notification callback (see MET_CAN_PROTOCOL_ERROR_DEFS)
+        typedef void (*MET_errorHandler_t)(uint8_t error);
+        
+        /// PARAMETER registers stored notification callback
+        typedef void (*MET_paramHandler_t)(void);
+        
+        /// ABORT command fast path callback (CAN interrupt context)
+        typedef void (*MET_abortHandler_t)(void);
+        
         
         /** 
         * ***REVISION STATUS REGISTER***
@@ -473,6 +546,21 @@
             uint8_t result[2];              //!< Command result data
             uint8_t error;                  //!< Command error code in case of unsuccess; 
        }MET_Command_Register_t;
+
+        /// Motor Bridge directions
+        typedef enum{
+            MET_CAN_BRIDGE_CAN0_TO_CAN1 = 0,    //!< CAN0 RX FIFO 1 to CAN1
+            MET_CAN_BRIDGE_CAN1_TO_CAN0,        //!< CAN1 RX FIFO 0 to CAN0
+            MET_CAN_BRIDGE_DIRECTIONS           //!< Number of directions
+        }MET_CAN_BRIDGE_DIRECTION_t;
+
+        /// Motor Bridge counters of a direction
+        typedef struct {
+            uint32_t forwarded;     //!< Frames transmitted on the destination channel
+            uint16_t overruns;      //!< RX FIFO message lost events (frames lost with the RX FIFO full)
+            uint16_t drops;         //!< Frames discarded: destination channel in bus-off
+            uint8_t max_level;      //!< Worst queue level (frames)
+        }MET_CanBridge_Counters_t;
            
        
             
@@ -503,13 +591,53 @@
         /**
          * If _MET_MOTOR_BRIDGE_ define is present 
          * this function activates the communication bridge from 
-         * CAN0-FIFO1 reception and CAN1-FIFO0 reception 
+         * CAN0-FIFO1 reception and CAN1-FIFO0 reception:
+         * it configures the CAN0 RX FIFO 1 and the CAN1 interrupt.
          */
         ext void MET_InitCanBridge(void);
         
         /// Application Main Loop function handler
         void MET_Can_Protocol_Loop(void);  
         
+        /// Registers an Application callback notified of the protocol errors
+        ext void MET_Can_Protocol_SetErrorHandler(MET_errorHandler_t pErrorHandler);
+        
+        /// Sends an Application stream frame, if the TX FIFO is free and no answer is pending
+        ext bool MET_Can_Protocol_SendStream(uint8_t* data);
+        
+        /// Registers an Application callback notified when the PARAMETER registers are stored
+        ext void MET_Can_Protocol_SetParamHandler(MET_paramHandler_t pParamHandler);
+        
+        /// Returns the worst reception to transmission latency (us @ 1Mbit/s)
+        ext uint16_t MET_Can_Protocol_GetMaxLatency(void);
+        
+        /// Resets the worst reception to transmission latency (ABORT latencies included)
+        ext void MET_Can_Protocol_ResetMaxLatency(void);
+        
+        /// Registers an Application callback called by the reception interrupt of an ABORT command
+        ext void MET_Can_Protocol_SetAbortHandler(MET_abortHandler_t pAbortHandler);
+        
+        /// Returns the worst ABORT reception to fast path callback completion latency (us @ 1Mbit/s)
+        ext uint16_t MET_Can_Protocol_GetMaxAbortLatency(void);
+        
+        /// Returns the worst ABORT reception to transmission latency (us @ 1Mbit/s)
+        ext uint16_t MET_Can_Protocol_GetMaxAbortAnswerLatency(void);
+        
+        /// Returns true if the device reset has been notified to the remote host
+        ext bool MET_Can_Protocol_IsResetNotified(void);
+        
+        /// Returns true if a STORE_PARAMS is in progress
+        ext bool MET_Can_Protocol_IsStorePending(void);
+        
+        /// Returns the number of words written into the SmartEEPROM since the first store
+        ext uint32_t MET_Can_Protocol_GetStoreWrites(void);
+        
+        /// Returns the number of SmartEEPROM sector reallocations since the startup
+        ext uint16_t MET_Can_Protocol_GetStoreReallocations(void);
+        
+        /// Returns the Motor Bridge counters of a direction (all zero without _MET_MOTOR_BRIDGE_)
+        ext void MET_Can_Bridge_GetCounters(MET_CAN_BRIDGE_DIRECTION_t direction, MET_CanBridge_Counters_t* counters);
+        
      /** @}*/  // metCanApi
         
     /** 
@@ -543,6 +671,9 @@
         /// Returns the pointer to the Application Data register array
         ext uint8_t  MET_Can_Protocol_GetData(uint8_t idx, uint8_t data_index);
     
+        /// Sets the whole content of a DATA register byte
+        ext void  MET_Can_Protocol_SetDataReg(uint8_t idx, uint8_t data_index, uint8_t val);
+        
         // The function tests the content of a Data register with a mask byte
         ext bool  MET_Can_Protocol_TestData(uint8_t idx, uint8_t data_index, uint8_t mask);
         
@@ -555,6 +686,9 @@
         /// This function shall be used to set the Default parameter value 
         ext void  MET_Can_Protocol_SetDefaultParameter(uint8_t idx, uint8_t d0, uint8_t d1, uint8_t d2, uint8_t d3);        
 
+        /// Sets a byte of a PARAMETER register (Application calculated parameters)
+        ext void  MET_Can_Protocol_SetParameterReg(uint8_t idx, uint8_t data_index, uint8_t val);
+
         /// Set the COMMAND EXECUTION return code
         ext void MET_Can_Protocol_returnCommandExecuting(void);
         
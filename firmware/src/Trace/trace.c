@@ -0,0 +1,155 @@
+#define _TRACE_C
+
+#include "application.h"
+#include "trace.h"
+#include "Shared/CAN/MET_can_protocol.h"
+
+/**
+ * \addtogroup TRACEMOD
+ *
+ *  @{
+ */
+
+#define TRACE_RING_MASK (TRACE_RING_SIZE - 1) //!< Ring index mask
+
+/// Trace module data structure
+static struct{
+    TRACE_RECORD_t ring[TRACE_RING_SIZE]; //!< Record ring
+    volatile uint32_t head;     //!< Total number of recorded events (next write position)
+
+    bool streaming;             //!< A streaming is in progress
+    uint32_t stream_idx;        //!< Next record to be streamed
+    uint32_t stream_end;        //!< Value of head at the streaming start
+    uint16_t streamed;          //!< Records streamed
+    uint16_t lost;              //!< Records overwritten before to be streamed
+}traceStruct;
+
+/// Library error callback: records the CAN protocol errors
+static void traceCanErrorHandler(uint8_t error){
+    traceEvent(TRACE_CAN_ERROR, error, 0, 0, 0);
+}
+
+/**
+ * This function initializes the module.
+ *
+ * The ring is cleared and the module is registered
+ * to the CAN library as protocol error handler.
+ */
+void traceInit(void){
+    traceClear();
+    MET_Can_Protocol_SetErrorHandler(traceCanErrorHandler);
+}
+
+/**
+ * This function clears the ring and stops a pending streaming.
+ */
+void traceClear(void){
+    traceStruct.streaming = false;
+    traceStruct.head = 0;
+}
+
+/**
+ * This function adds a record to the trace ring.
+ *
+ * The function can be called either in the main loop or
+ * in interrupt context: the record is written with the interrupts disabled.
+ *
+ * @param type event type
+ * @param d0 event data 0
+ * @param d1 event data 1
+ * @param d2 event data 2
+ * @param d3 event data 3
+ */
+void traceEvent(TRACE_EVENT_t type, uint8_t d0, uint8_t d1, uint8_t d2, uint8_t d3){
+    uint32_t t = RTC_Timer32CounterGet();
+
+    uint32_t primask = __get_PRIMASK();
+    __disable_irq();
+
+    TRACE_RECORD_t* rec = &traceStruct.ring[traceStruct.head & TRACE_RING_MASK];
+    traceStruct.head++;
+
+    rec->type = (uint8_t) type;
+    rec->t[0] = (uint8_t) t;
+    rec->t[1] = (uint8_t) (t >> 8);
+    rec->t[2] = (uint8_t) (t >> 16);
+    rec->d[0] = d0;
+    rec->d[1] = d1;
+    rec->d[2] = d2;
+    rec->d[3] = d3;
+
+    __set_PRIMASK(primask);
+}
+
+/**
+ * This function starts the streaming of the records
+ * present in the ring at the calling time.
+ *
+ * The records added during the streaming are not streamed.
+ * The oldest slot of a full ring is not streamed, because it is the next to be overwritten.
+ *
+ * @return the number of records to be streamed
+ */
+uint16_t traceStreamStart(void){
+    uint32_t head = traceStruct.head;
+
+    traceStruct.stream_end = head;
+    traceStruct.stream_idx = (head >= TRACE_RING_SIZE) ? head - TRACE_RING_SIZE + 1 : 0;
+    traceStruct.streamed = 0;
+    traceStruct.lost = 0;
+    traceStruct.streaming = true;
+
+    return (uint16_t) (head - traceStruct.stream_idx);
+}
+
+/**
+ * This function stops a pending streaming.
+ *
+ * The end of stream record is not sent.
+ */
+void traceStreamStop(void){
+    traceStruct.streaming = false;
+}
+
+/**
+ * This function handles the streaming and shall be called in the main loop.
+ *
+ * At every call, up to TRACE_STREAM_FRAMES_PER_LOOP records are queued.
+ * A record not accepted by the library (TX FIFO busy) is retried at the next call.
+ *
+ * The records overwritten by the writer before to be streamed are skipped
+ * and counted into the end of stream record.
+ */
+void traceLoop(void){
+    if(!traceStruct.streaming) return;
+
+    for(int i=0; i < TRACE_STREAM_FRAMES_PER_LOOP; i++){
+
+        // Completion: end of stream record
+        if(traceStruct.stream_idx == traceStruct.stream_end){
+            TRACE_RECORD_t end = {.type = TRACE_STREAM_END};
+            end.d[0] = (uint8_t) traceStruct.streamed;
+            end.d[1] = (uint8_t) (traceStruct.streamed >> 8);
+            end.d[2] = (uint8_t) traceStruct.lost;
+            end.d[3] = (uint8_t) (traceStruct.lost >> 8);
+            if(MET_Can_Protocol_SendStream((uint8_t*) &end)) traceStruct.streaming = false;
+            return;
+        }
+
+        // Skips the records already overwritten (or next to be overwritten)
+        uint32_t head = traceStruct.head;
+        if(head - traceStruct.stream_idx >= TRACE_RING_SIZE){
+            uint32_t idx = head - TRACE_RING_SIZE + 1;
+            if(idx > traceStruct.stream_end) idx = traceStruct.stream_end;
+            traceStruct.lost += (uint16_t) (idx - traceStruct.stream_idx);
+            traceStruct.stream_idx = idx;
+            continue;
+        }
+
+        if(!MET_Can_Protocol_SendStream((uint8_t*) &traceStruct.ring[traceStruct.stream_idx & TRACE_RING_MASK])) return;
+        traceStruct.stream_idx++;
+        traceStruct.streamed++;
+    }
+}
+
+/** @}*/
@@ -0,0 +1,121 @@
+#ifndef _TRACE_H
+#define _TRACE_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#ifdef __XC32
+#include "definitions.h"
+#endif
+
+#undef ext
+#undef ext_static
+
+#ifdef _TRACE_C
+    #define ext
+    #define ext_static static
+#else
+    #define ext extern
+    #define ext_static extern
+#endif
+
+/*!
+ * \defgroup TRACEMOD Event Trace Module
+ * \ingroup applicationModule
+ *
+ * This module records the application events in a RAM ring buffer
+ * and streams them over CAN on request.
+ *
+ * ## Module Function Description
+ *
+ * Every event is stored as a 8 byte record (\ref TRACE_RECORD_t),
+ * that is also the payload of the CAN frame used to stream it:
+ *
+ * |BYTE|NAME|DESCRIPTION|
+ * |:--|:--|:--|
+ * |0|TYPE|Event type (see \ref TRACE_EVENT_t)|
+ * |1|T0|Timestamp byte 0|
+ * |2|T1|Timestamp byte 1|
+ * |3|T2|Timestamp byte 2|
+ * |4..7|D0..D3|Event data (see \ref TRACE_EVENT_t)|
+ *
+ * The timestamp is the 24 bit RTC counter (1/1024 s units, wraps every 4.5 hours).
+ *
+ * The ring holds the last \ref TRACE_RING_SIZE records: when it is full,
+ * the oldest record is overwritten.
+ *
+ * ## Streaming
+ *
+ * The CMD_TRACE_STREAM protocol command starts the drain of the records
+ * present in the ring at the command time.
+ * The records are sent by traceLoop() on the CAN Id _CAN_ID_STREAM_BASE_ADDRESS + device Id,
+ * through the MET_Can_Protocol_SendStream() library function:
+ * a frame is queued only when the single CAN0 TX FIFO element is free
+ * and no protocol request is waiting for the answer.
+ * No more than \ref TRACE_STREAM_FRAMES_PER_LOOP frames are queued every main loop,
+ * so the control timing is not affected.
+ *
+ * At the end of the drain a \ref TRACE_STREAM_END record is sent, with the
+ * number of streamed records and the number of records lost because
+ * overwritten before to be streamed.
+ *
+ * The host/trace_decode tool rebuilds the move timeline from a CAN log.
+ *
+ * ## Module API
+ *
+ * + traceInit(): module initialization;
+ * + traceEvent(): adds a record to the ring (can be called in interrupt context);
+ * + traceStreamStart(): starts the streaming of the current ring content;
+ * + traceStreamStop(): stops a pending streaming;
+ * + traceClear(): clears the ring;
+ * + traceLoop(): streaming handler to be called in the main loop;
+ *
+ *  @{
+ */
+
+#define TRACE_RING_SIZE                 512 //!< Number of records of the ring (power of 2)
+#define TRACE_STREAM_FRAMES_PER_LOOP    1   //!< Max number of frames queued every main loop
+
+/// Trace event types
+typedef enum{
+    TRACE_NONE = 0,         //!< Not used
+    TRACE_MODE_CHANGE,      //!< Working mode change: D0 = new mode (STATUS_WORKING_MODE_t)
+    TRACE_CMD_START,        //!< Activation start: D0 = command, D1 = flags (bit0 protocol, bit1 key), D2..D3 = target (0.1mm)
+    TRACE_CMD_HOLD,         //!< Activation end of motion: D0 = command, D1 = error code (0 = target), D2..D3 = position (0.1mm)
+    TRACE_CMD_STOP,         //!< Activation completed: D0 = command, D1 = error code (0 = success), D2..D3 = position (0.1mm)
+    TRACE_SAMPLE,           //!< Activation tick: D0..D1 = position (0.1mm), D2 = power command (% of the nominal 24V, before the supply compensation), D3 = driver mode (MOTOR_MODE_t)
+    TRACE_BUZZER,           //!< Buzzer pattern request (started or queued): D0 = pulses, D1 = ton, D2 = toff (15.6ms units), D3 = priority (BUZZER_PRIORITY_t)
+    TRACE_CAN_ERROR,        //!< CAN protocol error: D0 = library error code
+    TRACE_SUPPLY_SAG,       //!< Motor supply sag (end of): D0 = min supply (0.1V), D1 = power (%), D2..D3 = duration (7.8ms units)
+    TRACE_SAFETY_EDGE,      //!< Safety feedback edge: D0 = input (0 motor, 1 needle), D1 = new level, D2..D3 = previous level duration (0.1ms, saturated)
+    TRACE_STREAM_END = 0xFF //!< End of stream: D0..D1 = streamed records, D2..D3 = lost records
+}TRACE_EVENT_t;
+
+/// Trace record
+typedef struct{
+    uint8_t type;   //!< Event type (see TRACE_EVENT_t)
+    uint8_t t[3];   //!< 24 bit timestamp (1/1024 s units)
+    uint8_t d[4];   //!< Event data
+}TRACE_RECORD_t;
+
+/// Module initialization
+ext void traceInit(void);
+
+/// Adds a record to the trace ring
+ext void traceEvent(TRACE_EVENT_t type, uint8_t d0, uint8_t d1, uint8_t d2, uint8_t d3);
+
+/// Clears the trace ring
+ext void traceClear(void);
+
+/// Starts the streaming of the ring content
+ext uint16_t traceStreamStart(void);
+
+/// Stops a pending streaming
+ext void traceStreamStop(void);
+
+/// Streaming handler, to be called in the main loop
+ext void traceLoop(void);
+
+/** @}*/
+
+#endif // _TRACE_H
@@ -45,6 +45,59 @@
  *   ```
  * 
  * 
+ * ## BUILD CONFIGURATIONS
+ * 
+ * + default: -O1, used for the debug sessions;
+ * + release: -O2 with the link time optimization (XC32 Global Options: wpo-lto);
+ * 
+ * Both configurations compile every function and data in its own section
+ * (-ffunction-sections, -fdata-sections) and remove the unused sections 
+ * at link time (--gc-sections).
+ * 
+ * The ROM/RAM usage per module (motors, protocol, MET library, plib) is reported 
+ * by the host tool host/size_report from the linker map files:
+ * 
+ * ```text
+ * make -C FW325.X size-report CONF=release
+ *   ```
+ * 
+ * ## CMCC AND HOT CODE CONFIGURATION
+ * 
+ * The CMCC (4KB cache of the flash) is configured by the startup code (config/default/startup_xc32.c).
+ * The following options are selected with the project preprocessor macros
+ * (XC32-gcc) and linker symbols (XC32-ld):
+ * 
+ * + _CMCC_DCACHE_ENABLED_: the CMCC caches also the data read from the flash 
+ * (constant tables, literal pools). The CMCC caches only the code memory space: 
+ * the SRAM (CAN message RAM, DMA buffers, shared RAM area) and the SmartEEPROM 
+ * are never cached, so no cache maintenance is required. The Application never writes 
+ * the flash (the Bootloader is entered with a reset).
+ * 
+ * + _HOT_CODE_ENABLED_: the functions declared with \ref HOT_CODE 
+ * (motor activation handler, ADC conversion path, CAN reception callback)
+ * are placed into the .hot_text section: the section is loaded into the flash 
+ * and copied at the startup into the fast RAM (see config/default/ATSAME51J20A.ld);
+ * 
+ * + __XC32_TCM_LENGTH (compiler and linker symbol: 0x800 or 0xC00): 
+ * the CMCC is split into cache and TCM (0x03000000, zero wait states), 
+ * and the .hot_text section is executed from the TCM instead of the SRAM;
+ * 
+ * ```text
+ * Menu-Production
+ * - Set Project Configuration
+ *    - Customize ..
+ *        - XC32 Global Options
+ *            - XC32-gcc
+ *                - Preprocessing and messages
+ *                    - Preprocessor macros: _HOT_CODE_ENABLED_ __XC32_TCM_LENGTH=0x800
+ *            - XC32-ld
+ *                - Additional options: -D__XC32_TCM_LENGTH=0x800
+ * 
+ *   ```
+ * 
+ * The execution time of the hot functions is measured with the 
+ * profiler probes (see \ref PROFMOD) PROFILE_MOTOR_LOOP and PROFILE_GET_X/Y/Z/SH.
+ * 
  * ## HARMONY 3 REVISION PACK 
  * 
  * The Application has been developed with the use of the Microchip Harmony 3
@@ -170,6 +223,31 @@ static const unsigned char  APPLICATION_MAJ_REV =  1 ;  //!< Revision Major Numb
 static const unsigned char  APPLICATION_MIN_REV =  0 ;  //!< Revision Minor Number
 static const unsigned char  APPLICATION_SUB_REV =  1 ;  //!< Revision build Number
 
+/**
+ * Uncomment the following line (or add the symbol to the project preprocessor macros)
+ * to compile the hot-path profiler (see \ref PROFMOD).
+ */
+//#define _PROFILER_ENABLED_
+
+/**
+ * Uncomment the following line (or add the symbol to the project preprocessor macros)
+ * to execute the hot functions from the fast RAM (see CMCC AND HOT CODE CONFIGURATION).
+ */
+//#define _HOT_CODE_ENABLED_
+
+/**
+ * Uncomment the following line (or add the symbol to the project preprocessor macros)
+ * to control the motor power with the MOT_STOP PWM (see \ref MOTMOD).
+ */
+//#define _MOTOR_PWM_ENABLED_
+
+#if defined(_HOT_CODE_ENABLED_) && defined(__XC32)
+    /// Places a function into the .hot_text section (executed from the TCM or SRAM)
+    #define HOT_CODE __attribute__((section(".hot_text"), noinline))
+#else
+    #define HOT_CODE
+#endif
+
 /** @}*/
         
 #endif 
\ No newline at end of file
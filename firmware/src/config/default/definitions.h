@@ -50,7 +50,10 @@
 #include <stdbool.h>
 #include "peripheral/nvmctrl/plib_nvmctrl.h"
 #include "peripheral/evsys/plib_evsys.h"
+#include "peripheral/eic/plib_eic.h"
+#include "peripheral/ccl/plib_ccl.h"
 #include "peripheral/tcc/plib_tcc0.h"
+#include "peripheral/tc/plib_tc0.h"
 #include "peripheral/adc/plib_adc0.h"
 #include "peripheral/port/plib_port.h"
 #include "peripheral/clock/plib_clock.h"
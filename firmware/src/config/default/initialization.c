@@ -45,6 +45,7 @@
 // *****************************************************************************
 #include "definitions.h"
 #include "device.h"
+#include "BootTime/boottime.h"
 
 
 
@@ -127,14 +128,20 @@ void SYS_Initialize ( void* data )
     PORT_Initialize();
 
     CLOCK_Initialize();
-
+    bootTimeMark(BOOT_PHASE_CLOCK);
 
 
 
     EVSYS_Initialize();
 
+    EIC_Initialize();
+
+    CCL_Initialize();
+
     TCC0_PWMInitialize();
 
+    TC0_CompareInitialize();
+
     ADC0_Initialize();
     ADC1_Initialize();
     CAN0_Initialize();
@@ -147,6 +154,7 @@ void SYS_Initialize ( void* data )
 
     NVIC_Initialize();
 
+    bootTimeMark(BOOT_PHASE_SYSTEM);
 }
 
 
@@ -75,6 +75,11 @@ void __attribute__((optimize("-O1"),section(".text.Dummy_Handler"),long_call, no
     {
     }
 }
+/* CAN0 interrupt: the Motor Bridge overrides it to serve its RX FIFO 1 (MET_can_protocol.c) */
+void __attribute__((weak)) CAN0_Handler(void)
+{
+    CAN0_InterruptHandler();
+}
 /* Device vectors list dummy definition*/
 extern void MemoryManagement_Handler   ( void ) __attribute__((weak, alias("Dummy_Handler")));
 extern void BusFault_Handler           ( void ) __attribute__((weak, alias("Dummy_Handler")));
@@ -94,22 +99,14 @@ extern void OSC32KCTRL_Handler         ( void ) __attribute__((weak, alias("Dumm
 extern void SUPC_OTHER_Handler         ( void ) __attribute__((weak, alias("Dummy_Handler")));
 extern void SUPC_BODDET_Handler        ( void ) __attribute__((weak, alias("Dummy_Handler")));
 extern void WDT_Handler                ( void ) __attribute__((weak, alias("Dummy_Handler")));
-extern void EIC_EXTINT_0_Handler       ( void ) __attribute__((weak, alias("Dummy_Handler")));
-extern void EIC_EXTINT_1_Handler       ( void ) __attribute__((weak, alias("Dummy_Handler")));
-extern void EIC_EXTINT_2_Handler       ( void ) __attribute__((weak, alias("Dummy_Handler")));
-extern void EIC_EXTINT_3_Handler       ( void ) __attribute__((weak, alias("Dummy_Handler")));
 extern void EIC_EXTINT_4_Handler       ( void ) __attribute__((weak, alias("Dummy_Handler")));
 extern void EIC_EXTINT_5_Handler       ( void ) __attribute__((weak, alias("Dummy_Handler")));
 extern void EIC_EXTINT_6_Handler       ( void ) __attribute__((weak, alias("Dummy_Handler")));
 extern void EIC_EXTINT_7_Handler       ( void ) __attribute__((weak, alias("Dummy_Handler")));
 extern void EIC_EXTINT_8_Handler       ( void ) __attribute__((weak, alias("Dummy_Handler")));
 extern void EIC_EXTINT_9_Handler       ( void ) __attribute__((weak, alias("Dummy_Handler")));
-extern void EIC_EXTINT_10_Handler      ( void ) __attribute__((weak, alias("Dummy_Handler")));
-extern void EIC_EXTINT_11_Handler      ( void ) __attribute__((weak, alias("Dummy_Handler")));
 extern void EIC_EXTINT_12_Handler      ( void ) __attribute__((weak, alias("Dummy_Handler")));
 extern void EIC_EXTINT_13_Handler      ( void ) __attribute__((weak, alias("Dummy_Handler")));
-extern void EIC_EXTINT_14_Handler      ( void ) __attribute__((weak, alias("Dummy_Handler")));
-extern void EIC_EXTINT_15_Handler      ( void ) __attribute__((weak, alias("Dummy_Handler")));
 extern void FREQM_Handler              ( void ) __attribute__((weak, alias("Dummy_Handler")));
 extern void NVMCTRL_0_Handler          ( void ) __attribute__((weak, alias("Dummy_Handler")));
 extern void NVMCTRL_1_Handler          ( void ) __attribute__((weak, alias("Dummy_Handler")));
@@ -176,7 +173,6 @@ extern void TCC3_MC1_Handler           ( void ) __attribute__((weak, alias("Dumm
 extern void TCC4_OTHER_Handler         ( void ) __attribute__((weak, alias("Dummy_Handler")));
 extern void TCC4_MC0_Handler           ( void ) __attribute__((weak, alias("Dummy_Handler")));
 extern void TCC4_MC1_Handler           ( void ) __attribute__((weak, alias("Dummy_Handler")));
-extern void TC0_Handler                ( void ) __attribute__((weak, alias("Dummy_Handler")));
 extern void TC1_Handler                ( void ) __attribute__((weak, alias("Dummy_Handler")));
 extern void TC2_Handler                ( void ) __attribute__((weak, alias("Dummy_Handler")));
 extern void TC3_Handler                ( void ) __attribute__((weak, alias("Dummy_Handler")));
@@ -238,22 +234,22 @@ const H3DeviceVectors exception_table=
     .pfnSUPC_BODDET_Handler        = SUPC_BODDET_Handler,
     .pfnWDT_Handler                = WDT_Handler,
     .pfnRTC_Handler                = RTC_InterruptHandler,
-    .pfnEIC_EXTINT_0_Handler       = EIC_EXTINT_0_Handler,
-    .pfnEIC_EXTINT_1_Handler       = EIC_EXTINT_1_Handler,
-    .pfnEIC_EXTINT_2_Handler       = EIC_EXTINT_2_Handler,
-    .pfnEIC_EXTINT_3_Handler       = EIC_EXTINT_3_Handler,
+    .pfnEIC_EXTINT_0_Handler       = EIC_EXTINT_0_InterruptHandler,
+    .pfnEIC_EXTINT_1_Handler       = EIC_EXTINT_1_InterruptHandler,
+    .pfnEIC_EXTINT_2_Handler       = EIC_EXTINT_2_InterruptHandler,
+    .pfnEIC_EXTINT_3_Handler       = EIC_EXTINT_3_InterruptHandler,
     .pfnEIC_EXTINT_4_Handler       = EIC_EXTINT_4_Handler,
     .pfnEIC_EXTINT_5_Handler       = EIC_EXTINT_5_Handler,
     .pfnEIC_EXTINT_6_Handler       = EIC_EXTINT_6_Handler,
     .pfnEIC_EXTINT_7_Handler       = EIC_EXTINT_7_Handler,
     .pfnEIC_EXTINT_8_Handler       = EIC_EXTINT_8_Handler,
     .pfnEIC_EXTINT_9_Handler       = EIC_EXTINT_9_Handler,
-    .pfnEIC_EXTINT_10_Handler      = EIC_EXTINT_10_Handler,
-    .pfnEIC_EXTINT_11_Handler      = EIC_EXTINT_11_Handler,
+    .pfnEIC_EXTINT_10_Handler      = EIC_EXTINT_10_InterruptHandler,
+    .pfnEIC_EXTINT_11_Handler      = EIC_EXTINT_11_InterruptHandler,
     .pfnEIC_EXTINT_12_Handler      = EIC_EXTINT_12_Handler,
     .pfnEIC_EXTINT_13_Handler      = EIC_EXTINT_13_Handler,
-    .pfnEIC_EXTINT_14_Handler      = EIC_EXTINT_14_Handler,
-    .pfnEIC_EXTINT_15_Handler      = EIC_EXTINT_15_Handler,
+    .pfnEIC_EXTINT_14_Handler      = EIC_EXTINT_14_InterruptHandler,
+    .pfnEIC_EXTINT_15_Handler      = EIC_EXTINT_15_InterruptHandler,
     .pfnFREQM_Handler              = FREQM_Handler,
     .pfnNVMCTRL_0_Handler          = NVMCTRL_0_Handler,
     .pfnNVMCTRL_1_Handler          = NVMCTRL_1_Handler,
@@ -293,7 +289,7 @@ const H3DeviceVectors exception_table=
     .pfnSERCOM5_1_Handler          = SERCOM5_1_Handler,
     .pfnSERCOM5_2_Handler          = SERCOM5_2_Handler,
     .pfnSERCOM5_OTHER_Handler      = SERCOM5_OTHER_Handler,
-    .pfnCAN0_Handler               = CAN0_InterruptHandler,
+    .pfnCAN0_Handler               = CAN0_Handler,
     .pfnCAN1_Handler               = CAN1_Handler,
     .pfnUSB_OTHER_Handler          = USB_OTHER_Handler,
     .pfnUSB_SOF_HSOF_Handler       = USB_SOF_HSOF_Handler,
@@ -321,7 +317,7 @@ const H3DeviceVectors exception_table=
     .pfnTCC4_OTHER_Handler         = TCC4_OTHER_Handler,
     .pfnTCC4_MC0_Handler           = TCC4_MC0_Handler,
     .pfnTCC4_MC1_Handler           = TCC4_MC1_Handler,
-    .pfnTC0_Handler                = TC0_Handler,
+    .pfnTC0_Handler                = TC0_CompareInterruptHandler,
     .pfnTC1_Handler                = TC1_Handler,
     .pfnTC2_Handler                = TC2_Handler,
     .pfnTC3_Handler                = TC3_Handler,
@@ -60,7 +60,17 @@ void Reset_Handler (void);
 void NonMaskableInt_Handler (void);
 void HardFault_Handler (void);
 void RTC_InterruptHandler (void);
+void EIC_EXTINT_0_InterruptHandler (void);
+void EIC_EXTINT_1_InterruptHandler (void);
+void EIC_EXTINT_2_InterruptHandler (void);
+void EIC_EXTINT_3_InterruptHandler (void);
+void EIC_EXTINT_10_InterruptHandler (void);
+void EIC_EXTINT_11_InterruptHandler (void);
+void EIC_EXTINT_14_InterruptHandler (void);
+void EIC_EXTINT_15_InterruptHandler (void);
 void CAN0_InterruptHandler (void);
+void CAN0_Handler (void);
+void TC0_CompareInterruptHandler (void);
 
 
 
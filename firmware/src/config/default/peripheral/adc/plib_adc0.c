@@ -111,6 +111,9 @@ void ADC0_Initialize( void )
     /* Resolution & Operation Mode */
     ADC0_REGS->ADC_CTRLB = ADC_CTRLB_RESSEL_12BIT | ADC_CTRLB_WINMODE(0) ;
 
+    /* Events configuration  */
+    ADC0_REGS->ADC_EVCTRL = (uint8_t)(ADC_EVCTRL_STARTEI_Msk | ADC_EVCTRL_WINMONEO_Msk);
+
 
     /* Clear all interrupt flags */
     ADC0_REGS->ADC_INTFLAG = ADC_INTFLAG_Msk;
@@ -110,6 +110,9 @@ void ADC1_Initialize( void )
     /* Resolution & Operation Mode */
     ADC1_REGS->ADC_CTRLB = ADC_CTRLB_RESSEL_8BIT | ADC_CTRLB_WINMODE(0) ;
 
+    /* Events configuration  */
+    ADC1_REGS->ADC_EVCTRL = (uint8_t)(ADC_EVCTRL_WINMONEO_Msk);
+
 
     /* Clear all interrupt flags */
     ADC1_REGS->ADC_INTFLAG = ADC_INTFLAG_Msk;
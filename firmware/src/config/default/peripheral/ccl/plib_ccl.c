@@ -0,0 +1,84 @@
+/*******************************************************************************
+  CCL Peripheral Library
+
+  Company:
+    Microchip Technology Inc.
+
+  File Name:
+    plib_ccl.c
+
+  Summary:
+    CCL Source File
+
+  Description:
+    None
+
+*******************************************************************************/
+
+/*******************************************************************************
+* Copyright (C) 2018 Microchip Technology Inc. and its subsidiaries.
+*
+* Subject to your compliance with these terms, you may use Microchip software
+* and any derivatives exclusively with Microchip products. It is your
+* responsibility to comply with third party license terms applicable to your
+* use of third party software (including open source software) that may
+* accompany Microchip software.
+*
+* THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS". NO WARRANTIES, WHETHER
+* EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED
+* WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+* PARTICULAR PURPOSE.
+*
+* IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE,
+* INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND
+* WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS
+* BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE
+* FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS IN
+* ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF ANY,
+* THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+*******************************************************************************/
+
+#include "plib_ccl.h"
+
+
+
+void CCL_Initialize( void )
+{
+    /* Reset all registers in the CCL module to their initial state and
+       CCL will be disabled. */
+    CCL_REGS->CCL_CTRL = CCL_CTRL_SWRST_Msk;
+
+    /* Sequential logic disabled: combinational LUTs only (no GCLK_CCL required) */
+    CCL_REGS->CCL_SEQCTRL[0] = CCL_SEQCTRL_SEQSEL(0U);
+    CCL_REGS->CCL_SEQCTRL[1] = CCL_SEQCTRL_SEQSEL(0U);
+
+    /* LUT0: IN0 EVENT (LUTIN_0: key EIC line), IN1 LINK (LUT1 output), OUT = IN0 | IN1 -> LUTOUT_0 event */
+    CCL_REGS->CCL_LUTCTRL[0] = CCL_LUTCTRL_TRUTH(0x0EU) | CCL_LUTCTRL_LUTEO(1U) | CCL_LUTCTRL_LUTEI(1U) | CCL_LUTCTRL_INVEI(0U) \
+                                | CCL_LUTCTRL_INSEL0(CCL_LUTCTRL_INSEL0_EVENT_Val) | CCL_LUTCTRL_INSEL1(CCL_LUTCTRL_INSEL0_LINK_Val) \
+                                | CCL_LUTCTRL_INSEL2(CCL_LUTCTRL_INSEL0_MASK_Val) | CCL_LUTCTRL_FILTSEL(0U) | CCL_LUTCTRL_EDGESEL(0U) \
+                                | CCL_LUTCTRL_ENABLE_Msk;
+
+    /* LUT1: IN0 EVENT (LUTIN_1: motor power switch EIC line), OUT = IN0 -> LUT0 IN1 */
+    CCL_REGS->CCL_LUTCTRL[1] = CCL_LUTCTRL_TRUTH(0x02U) | CCL_LUTCTRL_LUTEO(0U) | CCL_LUTCTRL_LUTEI(1U) | CCL_LUTCTRL_INVEI(0U) \
+                                | CCL_LUTCTRL_INSEL0(CCL_LUTCTRL_INSEL0_EVENT_Val) | CCL_LUTCTRL_INSEL1(CCL_LUTCTRL_INSEL0_MASK_Val) \
+                                | CCL_LUTCTRL_INSEL2(CCL_LUTCTRL_INSEL0_MASK_Val) | CCL_LUTCTRL_FILTSEL(0U) | CCL_LUTCTRL_EDGESEL(0U) \
+                                | CCL_LUTCTRL_ENABLE_Msk;
+
+    /* The CCL is enabled by the application (see CCL_Enable()) */
+    CCL_REGS->CCL_CTRL = CCL_CTRL_RUNSTDBY(0U);
+}
+
+void CCL_Enable( void )
+{
+    CCL_REGS->CCL_CTRL |= CCL_CTRL_ENABLE_Msk;
+}
+
+void CCL_Disable( void )
+{
+    CCL_REGS->CCL_CTRL &= (uint8_t)(~CCL_CTRL_ENABLE_Msk);
+}
+
+bool CCL_IsEnabled( void )
+{
+    return ((CCL_REGS->CCL_CTRL & CCL_CTRL_ENABLE_Msk) != 0U);
+}
@@ -80,7 +80,12 @@ static void FDPLL0_Initialize(void)
     {
         /* Waiting for the DPLL enable synchronization */
     }
+}
 
+/* The DPLL lock wait is split from the DPLL start: the lock time
+   overlaps the peripheral clock channels setup (boot time) */
+static void FDPLL0_WaitLock(void)
+{
     while((OSCCTRL_REGS->DPLL[0].OSCCTRL_DPLLSTATUS & (OSCCTRL_DPLLSTATUS_LOCK_Msk | OSCCTRL_DPLLSTATUS_CLKRDY_Msk)) !=
                 (OSCCTRL_DPLLSTATUS_LOCK_Msk | OSCCTRL_DPLLSTATUS_CLKRDY_Msk))
     {
@@ -153,12 +158,17 @@ void CLOCK_Initialize (void)
     DFLL_Initialize();
     GCLK1_Initialize();
     GCLK2_Initialize();
-    GCLK4_Initialize();
     FDPLL0_Initialize();
-    GCLK0_Initialize();
+    GCLK4_Initialize();
 
 
+    /* Selection of the Generator and write Lock for TC0 TC1 */
+    GCLK_REGS->GCLK_PCHCTRL[9] = GCLK_PCHCTRL_GEN(0x2)  | GCLK_PCHCTRL_CHEN_Msk;
 
+    while ((GCLK_REGS->GCLK_PCHCTRL[9] & GCLK_PCHCTRL_CHEN_Msk) != GCLK_PCHCTRL_CHEN_Msk)
+    {
+        /* Wait for synchronization */
+    }
     /* Selection of the Generator and write Lock for TCC0 TCC1 */
     GCLK_REGS->GCLK_PCHCTRL[25] = GCLK_PCHCTRL_GEN(0x1)  | GCLK_PCHCTRL_CHEN_Msk;
 
@@ -199,13 +209,19 @@ void CLOCK_Initialize (void)
     MCLK_REGS->MCLK_AHBMASK = 0xffffff;
 
     /* Configure the APBA Bridge Clocks */
-    MCLK_REGS->MCLK_APBAMASK = 0x7ff;
+    MCLK_REGS->MCLK_APBAMASK = 0x47ff;
 
     /* Configure the APBB Bridge Clocks */
-    MCLK_REGS->MCLK_APBBMASK = 0x18856;
+    MCLK_REGS->MCLK_APBBMASK = 0x188d6;
+
+    /* Configure the APBC Bridge Clocks */
+    MCLK_REGS->MCLK_APBCMASK = 0x6000;
 
     /* Configure the APBD Bridge Clocks */
     MCLK_REGS->MCLK_APBDMASK = 0x180;
 
+    /* The CPU clock is switched to the DPLL as the last step */
+    FDPLL0_WaitLock();
+    GCLK0_Initialize();
 
 }
@@ -0,0 +1,114 @@
+/*******************************************************************************
+  Interface definition of EIC PLIB.
+
+  Company:
+    Microchip Technology Inc.
+
+  File Name:
+    plib_eic.h
+
+  Summary:
+    Interface definition of the External Interrupt Controller Plib (EIC).
+
+  Description:
+    This file defines the interface for the EIC Plib.
+    It allows user to setup the external interrupt lines.
+*******************************************************************************/
+
+/*******************************************************************************
+* Copyright (C) 2018 Microchip Technology Inc. and its subsidiaries.
+*
+* Subject to your compliance with these terms, you may use Microchip software
+* and any derivatives exclusively with Microchip products. It is your
+* responsibility to comply with third party license terms applicable to your
+* use of third party software (including open source software) that may
+* accompany Microchip software.
+*
+* THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS". NO WARRANTIES, WHETHER
+* EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED
+* WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+* PARTICULAR PURPOSE.
+*
+* IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE,
+* INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND
+* WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS
+* BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE
+* FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS IN
+* ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF ANY,
+* THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+*******************************************************************************/
+
+#ifndef PLIB_EIC_H
+#define PLIB_EIC_H
+
+#include "device.h"
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+
+// DOM-IGNORE-BEGIN
+#ifdef __cplusplus // Provide C++ Compatibility
+extern "C" {
+#endif
+// DOM-IGNORE-END
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Data Types
+// *****************************************************************************
+// *****************************************************************************
+
+/* EIC Pin Count */
+#define EXTINT_COUNT                        (16U)
+
+typedef enum
+{
+    EIC_PIN_0 = 0,
+    EIC_PIN_1 = 1,
+    EIC_PIN_2 = 2,
+    EIC_PIN_3 = 3,
+    EIC_PIN_10 = 10,
+    EIC_PIN_11 = 11,
+    EIC_PIN_14 = 14,
+    EIC_PIN_15 = 15,
+    EIC_PIN_MAX = 16
+} EIC_PIN;
+
+typedef void (*EIC_CALLBACK) (uintptr_t context);
+
+typedef struct
+{
+    /* External Pin number */
+    EIC_PIN eicPinNo;
+
+    /* Callback for event on target pin*/
+    EIC_CALLBACK callback;
+
+    /* Callback Context */
+    uintptr_t context;
+
+} EIC_CALLBACK_OBJ;
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Interface Routines
+// *****************************************************************************
+// *****************************************************************************
+
+void EIC_Initialize (void);
+
+void EIC_CallbackRegister(EIC_PIN pin, EIC_CALLBACK callback, uintptr_t context);
+
+void EIC_InterruptEnable (EIC_PIN pin);
+
+void EIC_InterruptDisable (EIC_PIN pin);
+
+bool EIC_PinStateGet (EIC_PIN pin);
+
+// DOM-IGNORE-BEGIN
+#ifdef __cplusplus // Provide C++ Compatibility
+}
+#endif
+// DOM-IGNORE-END
+
+#endif /* PLIB_EIC_H */
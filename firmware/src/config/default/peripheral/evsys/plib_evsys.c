@@ -46,5 +46,38 @@
 void EVSYS_Initialize( void )
 {
     /*Event Channel User Configuration*/
+    EVSYS_REGS->EVSYS_USER[1] = EVSYS_USER_CHANNEL(0x1U);
+    EVSYS_REGS->EVSYS_USER[2] = EVSYS_USER_CHANNEL(0x2U);
+    EVSYS_REGS->EVSYS_USER[3] = EVSYS_USER_CHANNEL(0x6U);
+    EVSYS_REGS->EVSYS_USER[4] = EVSYS_USER_CHANNEL(0x7U);
+    EVSYS_REGS->EVSYS_USER[63] = EVSYS_USER_CHANNEL(0x4U);
+    EVSYS_REGS->EVSYS_USER[64] = EVSYS_USER_CHANNEL(0x5U);
 
+    /* Event Channel 0 Configuration: ADC0 WINMON -> PORT EV0 */
+    EVSYS_REGS->CHANNEL[0].EVSYS_CHANNEL = EVSYS_CHANNEL_EVGEN(104U) | EVSYS_CHANNEL_PATH(2U) | EVSYS_CHANNEL_EDGSEL(0U) \
+                                    | 0U | 0U ;
+
+    /* Event Channel 1 Configuration: ADC1 WINMON -> PORT EV1 */
+    EVSYS_REGS->CHANNEL[1].EVSYS_CHANNEL = EVSYS_CHANNEL_EVGEN(106U) | EVSYS_CHANNEL_PATH(2U) | EVSYS_CHANNEL_EDGSEL(0U) \
+                                    | 0U | 0U ;
+
+    /* Event Channel 2 Configuration: RTC PER0 -> ADC0 START (user connected by the application) */
+    EVSYS_REGS->CHANNEL[2].EVSYS_CHANNEL = EVSYS_CHANNEL_EVGEN(4U) | EVSYS_CHANNEL_PATH(2U) | EVSYS_CHANNEL_EDGSEL(0U) \
+                                    | 0U | 0U ;
+
+    /* Event Channel 3 Configuration: key EIC line -> CCL LUTIN0 (generator selected by the application) */
+    EVSYS_REGS->CHANNEL[3].EVSYS_CHANNEL = EVSYS_CHANNEL_EVGEN(0U) | EVSYS_CHANNEL_PATH(2U) | EVSYS_CHANNEL_EDGSEL(0U) \
+                                    | 0U | 0U ;
+
+    /* Event Channel 4 Configuration: EIC EXTINT10 (MOTOR_ENA_FEEDBACK) -> CCL LUTIN1 */
+    EVSYS_REGS->CHANNEL[4].EVSYS_CHANNEL = EVSYS_CHANNEL_EVGEN(28U) | EVSYS_CHANNEL_PATH(2U) | EVSYS_CHANNEL_EDGSEL(0U) \
+                                    | 0U | 0U ;
+
+    /* Event Channel 5 Configuration: CCL LUTOUT0 -> PORT EV2 */
+    EVSYS_REGS->CHANNEL[5].EVSYS_CHANNEL = EVSYS_CHANNEL_EVGEN(116U) | EVSYS_CHANNEL_PATH(2U) | EVSYS_CHANNEL_EDGSEL(0U) \
+                                    | 0U | 0U ;
+
+    /* Event Channel 6 Configuration: TC0 MC0 -> PORT EV3 (BUZZER toggle) */
+    EVSYS_REGS->CHANNEL[6].EVSYS_CHANNEL = EVSYS_CHANNEL_EVGEN(74U) | EVSYS_CHANNEL_PATH(2U) | EVSYS_CHANNEL_EDGSEL(0U) \
+                                    | 0U | 0U ;
 }
@@ -61,8 +61,32 @@ void NVIC_Initialize( void )
      * from within the "Interrupt Manager" of MHC. */
     NVIC_SetPriority(RTC_IRQn, 7);
     NVIC_EnableIRQ(RTC_IRQn);
+    NVIC_SetPriority(EIC_EXTINT_0_IRQn, 4);
+    NVIC_EnableIRQ(EIC_EXTINT_0_IRQn);
+    NVIC_SetPriority(EIC_EXTINT_1_IRQn, 4);
+    NVIC_EnableIRQ(EIC_EXTINT_1_IRQn);
+    NVIC_SetPriority(EIC_EXTINT_2_IRQn, 4);
+    NVIC_EnableIRQ(EIC_EXTINT_2_IRQn);
+    NVIC_SetPriority(EIC_EXTINT_3_IRQn, 4);
+    NVIC_EnableIRQ(EIC_EXTINT_3_IRQn);
+    NVIC_SetPriority(EIC_EXTINT_10_IRQn, 3);
+    NVIC_EnableIRQ(EIC_EXTINT_10_IRQn);
+    NVIC_SetPriority(EIC_EXTINT_11_IRQn, 3);
+    NVIC_EnableIRQ(EIC_EXTINT_11_IRQn);
+    NVIC_SetPriority(EIC_EXTINT_14_IRQn, 4);
+    NVIC_EnableIRQ(EIC_EXTINT_14_IRQn);
+    NVIC_SetPriority(EIC_EXTINT_15_IRQn, 4);
+    NVIC_EnableIRQ(EIC_EXTINT_15_IRQn);
     NVIC_SetPriority(CAN0_IRQn, 7);
     NVIC_EnableIRQ(CAN0_IRQn);
+    NVIC_SetPriority(TC0_IRQn, 7);
+    NVIC_EnableIRQ(TC0_IRQn);
+    NVIC_SetPriority(ADC0_OTHER_IRQn, 3);
+    NVIC_EnableIRQ(ADC0_OTHER_IRQn);
+    NVIC_SetPriority(ADC0_RESRDY_IRQn, 5);
+    NVIC_EnableIRQ(ADC0_RESRDY_IRQn);
+    NVIC_SetPriority(ADC1_OTHER_IRQn, 3);
+    NVIC_EnableIRQ(ADC1_OTHER_IRQn);
 
 
 
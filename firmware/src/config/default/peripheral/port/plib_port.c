@@ -81,16 +81,16 @@ void PORT_Initialize(void)
    PORT_REGS->GROUP[0].PORT_PINCFG[7] = 0x1;
    PORT_REGS->GROUP[0].PORT_PINCFG[8] = 0x40;
    PORT_REGS->GROUP[0].PORT_PINCFG[9] = 0x40;
-   PORT_REGS->GROUP[0].PORT_PINCFG[10] = 0x2;
-   PORT_REGS->GROUP[0].PORT_PINCFG[11] = 0x2;
+   PORT_REGS->GROUP[0].PORT_PINCFG[10] = 0x3;
+   PORT_REGS->GROUP[0].PORT_PINCFG[11] = 0x3;
    PORT_REGS->GROUP[0].PORT_PINCFG[12] = 0x41;
    PORT_REGS->GROUP[0].PORT_PINCFG[13] = 0x40;
-   PORT_REGS->GROUP[0].PORT_PINCFG[14] = 0x2;
-   PORT_REGS->GROUP[0].PORT_PINCFG[15] = 0x2;
-   PORT_REGS->GROUP[0].PORT_PINCFG[16] = 0x2;
-   PORT_REGS->GROUP[0].PORT_PINCFG[17] = 0x2;
-   PORT_REGS->GROUP[0].PORT_PINCFG[18] = 0x2;
-   PORT_REGS->GROUP[0].PORT_PINCFG[19] = 0x2;
+   PORT_REGS->GROUP[0].PORT_PINCFG[14] = 0x3;
+   PORT_REGS->GROUP[0].PORT_PINCFG[15] = 0x3;
+   PORT_REGS->GROUP[0].PORT_PINCFG[16] = 0x3;
+   PORT_REGS->GROUP[0].PORT_PINCFG[17] = 0x3;
+   PORT_REGS->GROUP[0].PORT_PINCFG[18] = 0x3;
+   PORT_REGS->GROUP[0].PORT_PINCFG[19] = 0x3;
    PORT_REGS->GROUP[0].PORT_PINCFG[20] = 0x6;
    PORT_REGS->GROUP[0].PORT_PINCFG[21] = 0x44;
    PORT_REGS->GROUP[0].PORT_PINCFG[22] = 0x1;
@@ -100,7 +100,11 @@ void PORT_Initialize(void)
    PORT_REGS->GROUP[0].PORT_PMUX[1] = 0x11;
    PORT_REGS->GROUP[0].PORT_PMUX[2] = 0x11;
    PORT_REGS->GROUP[0].PORT_PMUX[3] = 0x11;
+   PORT_REGS->GROUP[0].PORT_PMUX[5] = 0x0;
    PORT_REGS->GROUP[0].PORT_PMUX[6] = 0x5;
+   PORT_REGS->GROUP[0].PORT_PMUX[7] = 0x0;
+   PORT_REGS->GROUP[0].PORT_PMUX[8] = 0x0;
+   PORT_REGS->GROUP[0].PORT_PMUX[9] = 0x0;
    PORT_REGS->GROUP[0].PORT_PMUX[11] = 0x88;
 
    /************************** GROUP 1 Initialization *************************/
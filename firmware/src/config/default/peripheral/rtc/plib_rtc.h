@@ -116,6 +116,7 @@ typedef struct
 
 void RTC_Initialize(void);
 void RTC_Timer32Start ( void );
+void RTC_Timer32StartNoWait ( void );
 void RTC_Timer32Stop ( void );
 void RTC_Timer32CounterSet ( uint32_t count );
 uint32_t RTC_Timer32CounterGet ( void );
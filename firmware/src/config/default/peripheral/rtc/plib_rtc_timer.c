@@ -75,6 +75,8 @@ void RTC_Initialize(void)
         /* Wait for Synchronization after writing Compare Value */
     }
 
+    RTC_REGS->MODE0.RTC_EVCTRL = 0x1U;
+
     RTC_REGS->MODE0.RTC_INTENSET = 0x93U;
 
 }
@@ -90,6 +92,12 @@ void RTC_Timer32Start ( void )
     }
 }
 
+void RTC_Timer32StartNoWait ( void )
+{
+    /* The enable synchronization completes in the RTC clock domain (not waited) */
+    RTC_REGS->MODE0.RTC_CTRLA |= (uint16_t)RTC_MODE0_CTRLA_ENABLE_Msk;
+}
+
 
 void RTC_Timer32Stop ( void )
 {
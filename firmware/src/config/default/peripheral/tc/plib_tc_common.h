@@ -0,0 +1,131 @@
+/*******************************************************************************
+  TC Peripheral Library Interface Header File
+
+  Company
+    Microchip Technology Inc.
+
+  File Name
+    plib_tc_common.h
+
+  Summary
+    TC peripheral library interface.
+
+  Description
+    This file defines the interface to the TC peripheral library.  This
+    library provides access to and control of the associated peripheral
+    instance.
+
+******************************************************************************/
+
+// DOM-IGNORE-BEGIN
+/*******************************************************************************
+* Copyright (C) 2018 Microchip Technology Inc. and its subsidiaries.
+*
+* Subject to your compliance with these terms, you may use Microchip software
+* and any derivatives exclusively with Microchip products. It is your
+* responsibility to comply with third party license terms applicable to your
+* use of third party software (including open source software) that may
+* accompany Microchip software.
+*
+* THIS SOFTWARE IS SUPPLIED BY MICROCHIP "AS IS". NO WARRANTIES, WHETHER
+* EXPRESS, IMPLIED OR STATUTORY, APPLY TO THIS SOFTWARE, INCLUDING ANY IMPLIED
+* WARRANTIES OF NON-INFRINGEMENT, MERCHANTABILITY, AND FITNESS FOR A
+* PARTICULAR PURPOSE.
+*
+* IN NO EVENT WILL MICROCHIP BE LIABLE FOR ANY INDIRECT, SPECIAL, PUNITIVE,
+* INCIDENTAL OR CONSEQUENTIAL LOSS, DAMAGE, COST OR EXPENSE OF ANY KIND
+* WHATSOEVER RELATED TO THE SOFTWARE, HOWEVER CAUSED, EVEN IF MICROCHIP HAS
+* BEEN ADVISED OF THE POSSIBILITY OR THE DAMAGES ARE FORESEEABLE. TO THE
+* FULLEST EXTENT ALLOWED BY LAW, MICROCHIP'S TOTAL LIABILITY ON ALL CLAIMS IN
+* ANY WAY RELATED TO THIS SOFTWARE WILL NOT EXCEED THE AMOUNT OF FEES, IF ANY,
+* THAT YOU HAVE PAID DIRECTLY TO MICROCHIP FOR THIS SOFTWARE.
+*******************************************************************************/
+// DOM-IGNORE-END
+
+#ifndef PLIB_TC_COMMON_H    // Guards against multiple inclusion
+#define PLIB_TC_COMMON_H
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Included Files
+// *****************************************************************************
+// *****************************************************************************
+/*  This section lists the other files that are included in this file.
+*/
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+// DOM-IGNORE-BEGIN
+#ifdef __cplusplus  // Provide C++ Compatibility
+
+    extern "C" {
+
+#endif
+// DOM-IGNORE-END
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Data Types
+// *****************************************************************************
+// *****************************************************************************
+/*  The following data type definitions are used by the functions in this
+    interface and should be considered part it.
+*/
+// *****************************************************************************
+
+/* TC Compare interrupt status
+
+   Summary:
+    Identifies the TC compare interrupt status flags
+
+   Description:
+    This enumeration identifies the TC compare interrupt status flags.
+
+   Remarks:
+    None.
+*/
+typedef enum
+{
+    TC_COMPARE_STATUS_NONE = 0U,
+    TC_COMPARE_STATUS_OVERFLOW = TC_INTFLAG_OVF_Msk,
+    TC_COMPARE_STATUS_MATCH0 = TC_INTFLAG_MC0_Msk,
+    TC_COMPARE_STATUS_MATCH1 = TC_INTFLAG_MC1_Msk,
+    /* Force the compiler to reserve 32-bit memory for enum */
+    TC_COMPARE_STATUS_INVALID = 0xFFFFFFFFU
+}TC_COMPARE_STATUS;
+
+// *****************************************************************************
+
+typedef enum
+{
+    TC_COMMAND_NONE = 0U,
+    TC_COMMAND_START_RETRIGGER = 1U,
+    TC_COMMAND_STOP = 2U,
+    TC_COMMAND_FORCE_UPDATE = 3U,
+    TC_COMMAND_READ_SYNC = 4U
+}TC_COMMAND;
+
+// *****************************************************************************
+
+typedef void (*TC_COMPARE_CALLBACK)( TC_COMPARE_STATUS status, uintptr_t context );
+
+// *****************************************************************************
+
+typedef struct
+{
+    TC_COMPARE_CALLBACK callback;
+    uintptr_t context;
+}TC_COMPARE_CALLBACK_OBJ;
+
+
+// DOM-IGNORE-BEGIN
+#ifdef __cplusplus  // Provide C++ Compatibility
+
+    }
+
+#endif
+// DOM-IGNORE-END
+
+#endif /* PLIB_TC_COMMON_H */
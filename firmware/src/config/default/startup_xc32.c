@@ -48,6 +48,11 @@
 /* Initialize segments */
 extern uint32_t __svectors;
 
+/* Hot code section (see the linker script) */
+extern uint32_t _shot_text;
+extern uint32_t _ehot_text;
+extern uint32_t _shot_text_load;
+
 extern int main(void);
 extern void __attribute__((long_call)) __libc_init_array(void);
 
@@ -79,6 +84,16 @@ __STATIC_INLINE void TCM_Enable(void);
 __STATIC_INLINE void TCM_Configure(uint32_t tcmSize);
 __STATIC_INLINE void ICache_Enable(void);
 __STATIC_INLINE void DCache_Enable(void);
+__STATIC_INLINE void HotCode_Initialize(void);
+
+/* CMCC cache size (CSIZESW) with the TCM configured (the CMCC is 4KB) */
+#if defined(__XC32_TCM_LENGTH) && (__XC32_TCM_LENGTH >= 0xC00)
+#  define CMCC_CACHE_CSIZESW    0   /* 1KB cache, 3KB TCM */
+#elif defined(__XC32_TCM_LENGTH) && (__XC32_TCM_LENGTH > 0)
+#  define CMCC_CACHE_CSIZESW    1   /* 2KB cache, 2KB TCM */
+#else
+#  define CMCC_CACHE_CSIZESW    2   /* 4KB cache, no TCM */
+#endif
 
 /** Program CMCC CSIZESW bits for TCM and cache configuration */
 __STATIC_INLINE void TCM_Configure(uint32_t tcmSize)
@@ -105,10 +120,26 @@ __STATIC_INLINE void ICache_Enable(void)
     {
         /*Wait for the operation to complete*/
     }
+#ifndef _CMCC_DCACHE_ENABLED_
     CMCC_REGS->CMCC_CFG |= (CMCC_CFG_DCDIS_Msk);
+#endif
     CMCC_REGS->CMCC_CTRL = (CMCC_CTRL_CEN_Msk);
 }
 
+/* Copy the hot code from the flash to the TCM or SRAM */
+__STATIC_INLINE void HotCode_Initialize(void)
+{
+    uint32_t *pSrc = &_shot_text_load;
+    uint32_t *pDst = &_shot_text;
+
+    while(pDst < &_ehot_text)
+    {
+        *pDst++ = *pSrc++;
+    }
+    __DSB();
+    __ISB();
+}
+
 __STATIC_INLINE void DCache_Enable(void)
 {
 }
@@ -164,7 +195,7 @@ void __attribute__((optimize("-O1"), section(".text.Reset_Handler"), long_call,
 #endif
 
 
-    TCM_Configure(2);
+    TCM_Configure(CMCC_CACHE_CSIZESW);
 
     /* Enable TCM   */
     TCM_Enable();
@@ -173,6 +204,9 @@ void __attribute__((optimize("-O1"), section(".text.Reset_Handler"), long_call,
      * Data initialization from the XC32 .dinit template */
     __pic32c_data_initialization();
 
+    /* Copy the hot code into its execution region */
+    HotCode_Initialize();
+
 
 #  ifdef SCB_VTOR_TBLOFF_Msk
     /*  Set the vector-table base address in FLASH */
@@ -7,6 +7,11 @@
 #include "application.h"
 #include "Protocol/protocol.h"
 #include "Motors/motors.h"
+#include "Profiler/profiler.h"
+#include "Trace/trace.h"
+#include "Calibration/calibration.h"
+#include "BootTime/boottime.h"
+#include "Classifier/classifier.h"
 #include "main.h"
 
  /** 
@@ -17,20 +22,22 @@
      *  @{
      */
 
-static uint8_t trigger_time = 0;
+static volatile uint8_t trigger_time = 0;
 
 #define _1024_ms_TriggerTime    0x1
 #define _7820_us_TriggerTime    0x2
 #define _15_64_ms_TriggerTime   0x4
 #define _128_ms_TriggerTime     0x8
 
-static void XScrollDetection(void);
-static void NeedleIdDetection(void);
+static void SensorSnapshotUpdate(void);
 static void MotorPowerSupplyDetection(void);
-static void GetSHSensor(void);
-static void YFlipDetection(void);
-static void KeyboardHandler(void);
+static void MonitorDetection(void);
+static void HOT_CODE GetSHSensor(void);
 static void KeyboardHandler(void);
+static void KeyboardInit(void);
+static void KeyboardKeysUpdate(void);
+static void SafetyFeedbackInit(void);
+static void SafetyFeedbackHandler(void);
 
 struct {
   int period;
@@ -38,9 +45,138 @@ struct {
   bool status;
 }powerLight;
 
+/// Main loop timing telemetry data
+static struct{
+    uint32_t loop_count;    //!< Iterations executed in the current 1024ms period
+    uint32_t max_cycles;    //!< Worst iteration time in CPU cycles
+    volatile uint8_t t7_overruns;     //!< Merged 7.8ms events in the current 1024ms period
+    volatile uint8_t t15_overruns;    //!< Merged 15.6ms events in the current 1024ms period
+    volatile uint8_t t128_overruns;   //!< Merged 128ms events in the current 1024ms period
+    volatile uint8_t t1024_overruns;  //!< Merged 1024ms events in the current 1024ms period
+}loopTiming;
+
+static void TimingTelemetryInit(void);
+static void TimingTelemetryUpdate(void);
+
+#define POSITION_WINDOW_BAND    2   //!< Half width of the target band (0.1mm, as the activation handler)
+
+/// Target window of the position channel (free running ADC0 conversion)
+static struct{
+    bool active;            //!< The window is armed
+    volatile bool suspended; //!< The free running conversion is suspended (single conversion of another channel)
+    CALIB_AXIS_t axis;      //!< Axis of the position channel
+    ADC_POSINPUT input;     //!< Position channel
+    uint16_t low;           //!< Window low threshold (ADC units)
+    uint16_t high;          //!< Window high threshold (ADC units)
+}positionWindow;
+
+/// ADC0 channels of the position sensors
+static const ADC_POSINPUT positionInput[CALIB_AXES] = {ADC_POSINPUT_AIN5, ADC_POSINPUT_AIN6, ADC_POSINPUT_AIN7};
+
+#define KEY_EIC_XP  EIC_PIN_3   //!< EIC line of the X+ button (PA19)
+#define KEY_EIC_XM  EIC_PIN_2   //!< EIC line of the X- button (PA18)
+#define KEY_EIC_YP  EIC_PIN_1   //!< EIC line of the Y+ button (PA17)
+#define KEY_EIC_YM  EIC_PIN_0   //!< EIC line of the Y- button (PA16)
+#define KEY_EIC_ZP  EIC_PIN_15  //!< EIC line of the Z+ button (PA15)
+#define KEY_EIC_ZM  EIC_PIN_14  //!< EIC line of the Z- button (PA14)
+
+#define SAFETY_EIC_MOTOR    EIC_PIN_10  //!< EIC line of the motor power switch feedback (PA10)
+#define SAFETY_EIC_NEEDLE   EIC_PIN_11  //!< EIC line of the needle power switch feedback (PA11)
+#define SAFETY_PULSE_MAX_s  30          //!< Longer pulses are saturated (DWT cycle counter wrap: 35.8s)
+
+/// Safety feedback inputs
+typedef enum{
+    SAFETY_MOTOR = 0,       //!< Motor power switch feedback (MOTOR_ENA_FEEDBACK)
+    SAFETY_NEEDLE,          //!< Needle power switch feedback (NEEDLE_ENA_FEEDBACK)
+    SAFETY_INPUTS
+}SAFETY_INPUT_t;
+
+/// Safety feedback edge monitoring
+static struct{
+    bool level;             //!< Input level after the last edge
+    uint32_t cycles;        //!< DWT cycle counter at the last edge
+    uint32_t time;          //!< RTC counter at the last edge (1/1024s units)
+    uint8_t edges;          //!< Edges since the startup or the last CMD_TIMING_RESET (saturated)
+    uint8_t min_pulse;      //!< Shortest pulse (0.1ms units, saturated, 0 = no pulse)
+}safetyFeedback[SAFETY_INPUTS];
+
+#define POSITION_SAMPLE_PERIOD  8   //!< RTC counts between two position samples (PER0 event: 7.8125ms)
+#define POSITION_SAMPLE_CHANNEL 3   //!< EVSYS user value of the ADC0 START event (channel 2)
+
+/// Position samples of the RTC triggered conversions
+static struct{
+    CALIB_AXIS_t axis;      //!< Axis of the next triggered conversion
+    struct{
+        uint32_t time;      //!< Sample time (RTC counter, 1/1024s units)
+        uint16_t raw;       //!< Conversion result
+        bool fresh;         //!< The sample has not yet been consumed
+    }sample[CALIB_AXES];
+}positionSampler;
+
+static void XScrollChanged(uint8_t code);
+static uint8_t NeedleIdResolve(uint8_t code);
+static void NeedleIdChanged(uint8_t code);
+static void YFlipChanged(uint8_t code);
+
+/**
+ * X-SCROLL identification table (ON = OBSCURED SLOT, Vuc = VBoard 0.545)
+ * 
+ * |OC1|OC2|OC3|VBOARD|VuC|8bit ADC|CODE|
+ * |:--|:--|:--|:--|:--|:--|:--|
+ * |OFF|OFF|ON|1V6|0.872|63|XSCROLL_RIGHT|
+ * |OFF|ON|OFF|2V5|1.362|105|XSCROLL_CENTER|
+ * |ON|OFF|OFF|4V12|2.245|173|XSCROLL_LEFT|
+ * |OFF|OFF|OFF|5V|2.72|210|XSCROLL_UNDETECTED|
+ */
+static const CLASSIFIER_BAND_t xscrollBands[] = {
+    {84, XSCROLL_RIGHT}, {139, XSCROLL_CENTER}, {191, XSCROLL_LEFT}, {0, XSCROLL_UNDETECTED}
+};
+
+/**
+ * Needle identification table (Vuc = VBoard 0.545)
+ * 
+ * |U1|U2|VBOUT|8bit ADC|CODE|
+ * |:--|:--|:--|:--|:--|
+ * |OFF|OFF|2.14V|90|NEEDLE_UNDETECTED|
+ * |OFF|ON|2.73V|114|NEEDLE_A|
+ * |ON|OFF|3.33V|140|NEEDLE_B|
+ * |ON|ON|5V|255|NEEDLE_C (NEEDLE_DISCONNECTED without the needle disable signal)|
+ */
+static const CLASSIFIER_BAND_t needleBands[] = {
+    {102, NEEDLE_UNDETECTED}, {127, NEEDLE_A}, {200, NEEDLE_B}, {0, NEEDLE_C}
+};
+
+/// Y flip table: the YRIB signal goes to 0V when Y is UP
+static const CLASSIFIER_BAND_t yflipBands[] = {
+    {1, 0}, {0, 1}
+};
+
+#define SENSOR_DEBOUNCE_ms      512 //!< Debounce time of the slow sensors (4 classifications)
+#define SENSOR_ADC_HYSTERESIS   4   //!< Hysteresis of the analog sensors (8 bit ADC units)
+
+/// Slow sensor classification descriptors (see \ref CLASSMOD)
+static const CLASSIFIER_SENSOR_t sensorClassifier[] = {
+    {&deviceStruct.sensors.xscroll, xscrollBands, CLASSIFIER_BANDS(xscrollBands), SENSOR_ADC_HYSTERESIS, SENSOR_DEBOUNCE_ms, XSCROLL_UNDETECTED, NULL, XScrollChanged},
+    {&deviceStruct.sensors.needle_id, needleBands, CLASSIFIER_BANDS(needleBands), SENSOR_ADC_HYSTERESIS, SENSOR_DEBOUNCE_ms, NEEDLE_UNDETECTED, NeedleIdResolve, NeedleIdChanged},
+    {&deviceStruct.sensors.yrib, yflipBands, CLASSIFIER_BANDS(yflipBands), 0, SENSOR_DEBOUNCE_ms, 0, NULL, YFlipChanged},
+};
+
+#define SENSOR_CLASSIFIERS  (sizeof(sensorClassifier) / sizeof(sensorClassifier[0])) //!< Number of classified sensors
+
+static CLASSIFIER_STATE_t sensorClassifierState[SENSOR_CLASSIFIERS];
+
+static uint16_t HOT_CODE Adc0Convert(ADC_POSINPUT input);
+static void Adc0WindowSuspend(void);
+static void Adc0WindowResume(void);
+static void Adc0SamplerHold(void);
+static void Adc0SamplerRelease(void);
+static void PositionSamplerInit(void);
+static void PositionSampleStore(CALIB_AXIS_t ax, uint16_t raw);
+static void HOT_CODE PositionUpdate(CALIB_AXIS_t ax, int raw, uint32_t time);
+
 static BUZZER_t buzzerStruct;
 static void BuzzerInit(void);
-static void Buzzerhandle(void);
+static void BuzzerSegmentCallback(TC_COMPARE_STATUS status, uintptr_t context);
  
 void powerLightInit(int period){
     uc_LAMP_ON_Set();
@@ -81,11 +217,29 @@ void setPowerLight(bool status, int duty){
 static void rtcEventHandler (RTC_TIMER32_INT_MASK intCause, uintptr_t context)
 {
     // Periodic Interval Handler: Freq = 1024 / 2 ^ (n+3)
+    // An event still pending from the previous period is merged (counted as overrun)
     
-    if (intCause & RTC_TIMER32_INT_MASK_PER0) trigger_time |= _7820_us_TriggerTime;  // 7.82ms Interrupt
-    if (intCause & RTC_TIMER32_INT_MASK_PER1) trigger_time |= _15_64_ms_TriggerTime; // 15.64ms Interrupt
-    if (intCause & RTC_TIMER32_INT_MASK_PER4) trigger_time |= _128_ms_TriggerTime;   // 128 ms Interrupt
-    if (intCause & RTC_TIMER32_INT_MASK_PER7) trigger_time |= _1024_ms_TriggerTime;  // 1024 ms Interrupt
+    if (intCause & RTC_TIMER32_INT_MASK_PER0){ // 7.82ms Interrupt
+        if((trigger_time & _7820_us_TriggerTime) && (loopTiming.t7_overruns < 255)) loopTiming.t7_overruns++;
+        trigger_time |= _7820_us_TriggerTime;  
+        
+        // The free running position channel is sampled at the same period:
+        // not during a single conversion of another channel (the result read would clear its RESRDY)
+        // and not before the first conversion after the resume (RESRDY cleared)
+        if((positionWindow.active) && (!positionWindow.suspended) && (ADC0_ConversionStatusGet())) PositionSampleStore(positionWindow.axis, ADC0_ConversionResultGet());
+    }
+    if (intCause & RTC_TIMER32_INT_MASK_PER1){ // 15.64ms Interrupt
+        if((trigger_time & _15_64_ms_TriggerTime) && (loopTiming.t15_overruns < 255)) loopTiming.t15_overruns++;
+        trigger_time |= _15_64_ms_TriggerTime; 
+    }
+    if (intCause & RTC_TIMER32_INT_MASK_PER4){ // 128 ms Interrupt
+        if((trigger_time & _128_ms_TriggerTime) && (loopTiming.t128_overruns < 255)) loopTiming.t128_overruns++;
+        trigger_time |= _128_ms_TriggerTime;   
+    }
+    if (intCause & RTC_TIMER32_INT_MASK_PER7){ // 1024 ms Interrupt
+        if((trigger_time & _1024_ms_TriggerTime) && (loopTiming.t1024_overruns < 255)) loopTiming.t1024_overruns++;
+        trigger_time |= _1024_ms_TriggerTime;  
+    }
     
 }
 
@@ -96,69 +250,128 @@ int main ( void )
 {
     /* Initialize all modules */
     SYS_Initialize ( NULL );
+    
+    // Hot-path profiler (only with _PROFILER_ENABLED_)
+    PROFILE_INIT();
+    
+    // Main loop timing measurement
+    TimingTelemetryInit();
 
     // Registers the RTC interrupt routine to the RTC module
     RTC_Timer32CallbackRegister(rtcEventHandler, 0);
-    RTC_Timer32Start(); // Start the RTC module
+    
+    // Starts the RTC module without waiting the enable synchronization:
+    // the synchronization (RTC clock domain) overlaps the following initialization
+    RTC_Timer32StartNoWait();
     
     // Application Protocol initialization
     ApplicationProtocolInit();
     
+    // Calibration parameters (after the protocol initialization)
+    calibrationInit();
+    bootTimeMark(BOOT_PHASE_PROTOCOL);
+    
+    // Event trace initialization (after the protocol initialization)
+    traceInit();
+    
     // ADC Initialization
     ADC0_Enable();
     ADC1_Enable();
+    PositionSamplerInit();
     
     motorInit();
     
+#ifdef _PROFILER_ENABLED_
+    // Stop latency of the hardware chain and of the WINMON interrupt (driver disabled)
+    motorStopLatencyTest();
+#endif
+    
     BuzzerInit();
     
+    KeyboardInit();
+    
+    SafetyFeedbackInit();
+    
+    classifierInit(sensorClassifier, sensorClassifierState, SENSOR_CLASSIFIERS);
+    
     // Sets the the frequency of PWM to 20 kHz
     // Funzione comunque non pi utilizzata in quest'applicazione 
     powerLightInit(150);
 
+    bootTimeMark(BOOT_PHASE_LOOP);
     
     while ( true )
     {
+        uint32_t loop_start = DWT->CYCCNT;
+        
         /* Maintain state machines of all polled MPLAB Harmony modules. */
         SYS_Tasks ( );
                 
         // Protocol management
         ApplicationProtocolLoop();
         
+        // Trace streaming (background)
+        traceLoop();
+        
         if(trigger_time & _1024_ms_TriggerTime){
             trigger_time &=~ _1024_ms_TriggerTime;            
-            MotorPowerSupplyDetection();
             VITALITY_LED_Toggle(); 
+            TimingTelemetryUpdate();
+            bootTimeUpdate();
         }        
  
         // Timer events activated into the RTC interrupt
         if(trigger_time & _7820_us_TriggerTime){
             trigger_time &=~ _7820_us_TriggerTime;
+            
+            // The supply is measured at the control rate for the power compensation
+            // and the over-current detection
+            PROFILE_BEGIN(PROFILE_POWER_DETECTION);
+            MotorPowerSupplyDetection();
+            MonitorDetection();
+            PROFILE_END(PROFILE_POWER_DETECTION);
+            
+            PROFILE_BEGIN(PROFILE_MOTOR_LOOP);
             motorLoop();
+            PROFILE_END(PROFILE_MOTOR_LOOP);
         }
 
         if(trigger_time & _15_64_ms_TriggerTime){
             trigger_time &=~ _15_64_ms_TriggerTime;      
             
+            PROFILE_BEGIN(PROFILE_GET_SH);
             GetSHSensor();
-            Buzzerhandle();
+            PROFILE_END(PROFILE_GET_SH);
            
         }
         
         if(trigger_time & _128_ms_TriggerTime){
             trigger_time &=~ _128_ms_TriggerTime;      
             
-            XScrollDetection();
-            NeedleIdDetection();
-            YFlipDetection();
+            PROFILE_BEGIN(PROFILE_SENSOR_SNAPSHOT);
+            SensorSnapshotUpdate();
+            PROFILE_END(PROFILE_SENSOR_SNAPSHOT);
+            
+            PROFILE_BEGIN(PROFILE_SENSOR_CLASSIFIER);
+            classifierRun(sensorClassifier, sensorClassifierState, SENSOR_CLASSIFIERS);
+            PROFILE_END(PROFILE_SENSOR_CLASSIFIER);
+            
+            PROFILE_BEGIN(PROFILE_KEYBOARD);
             KeyboardHandler();
+            PROFILE_END(PROFILE_KEYBOARD);
+            
+            SafetyFeedbackHandler();
             
             // Updates the sensors
-            GetX();
-            GetY();
-            GetZ();
+            if(!PositionSampleGet(CALIB_AXIS_X)) GetX();
+            if(!PositionSampleGet(CALIB_AXIS_Y)) GetY();
+            if(!PositionSampleGet(CALIB_AXIS_Z)) GetZ();
         }
         
+        // Main loop timing
+        uint32_t loop_cycles = DWT->CYCCNT - loop_start;
+        if(loop_cycles > loopTiming.max_cycles) loopTiming.max_cycles = loop_cycles;
+        loopTiming.loop_count++;
     }
 
     /* Execution should not come here during normal operation */
@@ -166,171 +379,448 @@ int main ( void )
     return ( EXIT_FAILURE );
 }
 
-#define XSCROLL_DEBOUNCE 4 
-void XScrollDetection(void){
-    static int debounce = XSCROLL_DEBOUNCE; // About 500ms
+/**
+ * This function initializes the main loop timing telemetry.
+ * 
+ * The iteration time is measured with the DWT cycle counter
+ * that is enabled here (the profiler module, if present, makes use of the same counter).
+ */
+void TimingTelemetryInit(void){
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+    TimingTelemetryReset();
+}
 
-    STATUS_XSCROLL_t xscroll_stat;
-    
-    // Reads the sensor
-    ADC1_ChannelSelect( ADC_POSINPUT_AIN1, ADC_NEGINPUT_GND );
-    ADC1_ConversionStart();
-    while(!ADC1_ConversionStatusGet());
-    deviceStruct.sensors.xscroll = (int) ADC1_ConversionResultGet();    
-    StatusAnalogRegister.X_SCROLL = deviceStruct.sensors.xscroll;
+/**
+ * This function clears the worst case timing values and the tick overrun counters.
+ * 
+ * The function is called by the CMD_TIMING_RESET protocol command.
+ */
+void TimingTelemetryReset(void){
+    loopTiming.max_cycles = 0;
+    StatusLoopTimeRegister.TL = 0;
+    StatusLoopTimeRegister.TH = 0;
+    StatusLoopTimeRegister.LL = 0;
+    StatusLoopTimeRegister.LH = 0;
+    StatusTickOverrunRegister.T7 = 0;
+    StatusTickOverrunRegister.T15 = 0;
+    StatusTickOverrunRegister.T128 = 0;
+    StatusTickOverrunRegister.T1024 = 0;
     
-    // Identification Table
-    // Vuc = VBoard 0.545 ->
-    // ON = OBSCURED SLOT
-    // OC1 - OC2 - OC3 - VBOARD - VuC   - 8bit ADC
-    // OFF - OFF - OFF = 5V     = 2.72  - 210
-    // OFF - OFF - ON  = 1V6    = 0.872 - 63
-    // OFF - ON - OFF  = 2V5    = 1.362 - 105
-    // ON - OFF - OFF  = 4V12   = 2.245 - 173
-    
-    if(deviceStruct.sensors.xscroll < 84) xscroll_stat = XSCROLL_RIGHT;
-    else if(deviceStruct.sensors.xscroll < 139) xscroll_stat = XSCROLL_CENTER;
-    else if(deviceStruct.sensors.xscroll < 191) xscroll_stat = XSCROLL_LEFT;
-    else xscroll_stat = XSCROLL_UNDETECTED;
-    
-    
-    // Detects the change in the current status
-    if((StatusModeRegister.xscroll_code == xscroll_stat)){
-         debounce = XSCROLL_DEBOUNCE;
-         return;
-    }         
-    debounce--;     
-    
-    // Change the status
-    if(debounce == 0){
-        StatusModeRegister.xscroll_code = xscroll_stat;
-        debounce = XSCROLL_DEBOUNCE;
-        
-        // Buzzer Sound Here
-        if(StatusModeRegister.xscroll_code == XSCROLL_UNDETECTED) BuzzerSet(3,3,3);
-        else BuzzerSet(1,20,5);
-        return;
+    bool irq = NVIC_INT_Disable();
+    loopTiming.t7_overruns = 0;
+    loopTiming.t15_overruns = 0;
+    loopTiming.t128_overruns = 0;
+    loopTiming.t1024_overruns = 0;
+    for(int i = 0; i < SAFETY_INPUTS; i++){
+        safetyFeedback[i].edges = 0;
+        safetyFeedback[i].min_pulse = 0;
     }
+    StatusSafetyRegister.ME = 0;
+    StatusSafetyRegister.NE = 0;
+    StatusSafetyRegister.MP = 0;
+    StatusSafetyRegister.NP = 0;
+    NVIC_INT_Restore(irq);
     
-    return;
+    StatusAbortLatencyRegister.BL = 0;
+    StatusAbortLatencyRegister.BH = 0;
+    StatusAbortLatencyRegister.AL = 0;
+    StatusAbortLatencyRegister.AH = 0;
+    MET_Can_Protocol_ResetMaxLatency();
 }
 
-#define YFLIP_DEBOUNCE 4 
-void YFlipDetection(void){
-    static int debounce = YFLIP_DEBOUNCE; // About 500ms
+/**
+ * This function upgrades the timing STATUS registers.
+ * 
+ * It shall be called every 1024ms: the loop counter 
+ * and the tick overrun counters are latched into the 
+ * LOOP RATE and TICK OVERRUN registers and restarted.
+ */
+void TimingTelemetryUpdate(void){
+    uint32_t val = loopTiming.loop_count;
+    loopTiming.loop_count = 0;
     
-    // The signal goes to 0V when Y is UP
-    bool input_stat = !uc_YRIB_Get();
-    if(input_stat == deviceStruct.Yup){
-        debounce = YFLIP_DEBOUNCE;
-        StatusModeRegister.y_up_detected = deviceStruct.Yup;
-        return;
-    }
+    bool irq = NVIC_INT_Disable();
+    StatusTickOverrunRegister.T7 = loopTiming.t7_overruns;
+    StatusTickOverrunRegister.T15 = loopTiming.t15_overruns;
+    StatusTickOverrunRegister.T128 = loopTiming.t128_overruns;
+    StatusTickOverrunRegister.T1024 = loopTiming.t1024_overruns;
+    loopTiming.t7_overruns = 0;
+    loopTiming.t15_overruns = 0;
+    loopTiming.t128_overruns = 0;
+    loopTiming.t1024_overruns = 0;
+    NVIC_INT_Restore(irq);
     
-    debounce--; 
+    StatusLoopRateRegister.L0 = (unsigned char) (val & 0xFF);
+    StatusLoopRateRegister.L1 = (unsigned char) ((val >> 8) & 0xFF);
+    StatusLoopRateRegister.L2 = (unsigned char) ((val >> 16) & 0xFF);
+    StatusLoopRateRegister.L3 = (unsigned char) ((val >> 24) & 0xFF);
     
-    // Change the status
-    if(debounce == 0){
-        StatusModeRegister.y_up_detected = deviceStruct.Yup = input_stat;
-        debounce = YFLIP_DEBOUNCE;
-        
-        // Buzzer Sound Here: 1 pulse for Up, 2 pulses for down
-        if(deviceStruct.Yup) BuzzerSet(1,20,5);
-        else BuzzerSet(2,5,5);
-        
-        return;
-    }
+    val = loopTiming.max_cycles / (CPU_CLOCK_FREQUENCY / 1000000);
+    if(val > 0xFFFF) val = 0xFFFF;
+    StatusLoopTimeRegister.TL = (unsigned char) (val & 0xFF);
+    StatusLoopTimeRegister.TH = (unsigned char) ((val >> 8) & 0xFF);
     
-    return;
+    val = MET_Can_Protocol_GetMaxLatency();
+    StatusLoopTimeRegister.LL = (unsigned char) (val & 0xFF);
+    StatusLoopTimeRegister.LH = (unsigned char) ((val >> 8) & 0xFF);
+    
+    val = MET_Can_Protocol_GetMaxAbortLatency();
+    StatusAbortLatencyRegister.BL = (unsigned char) (val & 0xFF);
+    StatusAbortLatencyRegister.BH = (unsigned char) ((val >> 8) & 0xFF);
+    val = MET_Can_Protocol_GetMaxAbortAnswerLatency();
+    StatusAbortLatencyRegister.AL = (unsigned char) (val & 0xFF);
+    StatusAbortLatencyRegister.AH = (unsigned char) ((val >> 8) & 0xFF);
 }
 
-#define NEEDLE_DEBOUNCE 4 
-void NeedleIdDetection(void){
-    static int debounce = NEEDLE_DEBOUNCE; // About 500ms
-    STATUS_NEEDLE_t needle_stat;
+/**
+ * This function acquires the snapshot of the slow sensors.
+ * 
+ * It is called every 128ms before the classification (see classifierRun()):
+ * + X-SCROLL (ADC1 AIN1) and NEEDLE ID (ADC1 AIN0): 8 bit conversions;
+ * + Y flip (YRIB input): 1 when the signal goes to 0V (Y is UP).
+ */
+static void SensorSnapshotUpdate(void){
+    ADC1_ChannelSelect( ADC_POSINPUT_AIN1, ADC_NEGINPUT_GND );
+    ADC1_ConversionStart();
+    while(!ADC1_ConversionStatusGet());
+    deviceStruct.sensors.xscroll = (int) ADC1_ConversionResultGet();    
+    StatusAnalogRegister.X_SCROLL = deviceStruct.sensors.xscroll;
     
-    // Reads the sensor
     ADC1_ChannelSelect( ADC_POSINPUT_AIN0, ADC_NEGINPUT_GND );
     ADC1_ConversionStart();
     while(!ADC1_ConversionStatusGet());
     deviceStruct.sensors.needle_id = (int) ADC1_ConversionResultGet();
     StatusAnalogRegister.NEEDLE_ID = deviceStruct.sensors.needle_id;
     
-    // Reads the Needle Ena Enable feedback 
-    // When the input is zero it means that the disable is true (power switch disabled)
-    StatusModeRegister.power_sw_needle_disable = deviceStruct.needle_disable_stat = uc_NEEDLE_ENA_FEEDBACK_Get();
-   
+    deviceStruct.sensors.yrib = !uc_YRIB_Get();
+}
+
+/// X-SCROLL change: 3 short pulses when undetected, 1 long pulse otherwise
+static void XScrollChanged(uint8_t code){
+    StatusModeRegister.xscroll_code = code;
+    if(code == XSCROLL_UNDETECTED) BuzzerSet(3,3,3);
+    else BuzzerSet(1,20,5);
+}
+
+/**
+ * The code of the highest band (5V) depends on the needle disable signal:
+ * if it is present the adapter is connected (type C), otherwise the adapter is not connected.
+ * The signal is upgraded by the safety feedback interrupt (see SafetyFeedbackInit()).
+ */
+static uint8_t NeedleIdResolve(uint8_t code){
+    if((code == NEEDLE_C) && (!deviceStruct.needle_disable_stat)) return NEEDLE_DISCONNECTED;
+    return code;
+}
+
+/// Needle identification change
+static void NeedleIdChanged(uint8_t code){
+    StatusModeRegister.needle_code = code;
+}
 
+/// Y flip change: 1 pulse for Up, 2 pulses for down
+static void YFlipChanged(uint8_t code){
+    StatusModeRegister.y_up_detected = deviceStruct.Yup = (code != 0);
+    if(deviceStruct.Yup) BuzzerSet(1,20,5);
+    else BuzzerSet(2,5,5);
+}
+
+/**
+ * This function measures the motor power supply (AIN9, ANL_MONITOR_VM).
+ * 
+ * The function is called every 7.8ms, before the motor loop,
+ * that compensates the motor power with the supply voltage (see \ref MOTMOD).
+ * The measure is filtered with a 1/4 IIR filter (time constant about 31ms).
+ * 
+ * During a motor activation the ADC1 window comparator is armed 
+ * for this conversion only (the other ADC1 channels are not monitored):
+ * a result below the over-current threshold generates the WINMON interrupt
+ * that stops the motor at the end of the conversion (see motorOverCurrentThreshold()).
+ * 
+ * Convertion factor 1V -> 0.125V
+ */
+void MotorPowerSupplyDetection(){
+    static int filter = -1; // Filter accumulator (4 x 0.1V units)
+    uint16_t threshold = motorOverCurrentThreshold();
     
-    // Identification Table
-    // Vuc = VBoard 0.545
-    // U1   -   U2  -   VBOUT   - Digit
-    //---------------------------------------
-    // OFF  -   OFF -   2.14V   - 90
-    // OFF  -   ON  -   2.73V   - 114
-    // ON   -   OFF -   3.33V   - 140
-    // ON   -   ON  -   5V      - 255
-    // DISCONNECTED DEVICE = 5V
+    ADC1_ChannelSelect( ADC_POSINPUT_AIN9, ADC_NEGINPUT_GND );
+    if(threshold){
+        ADC1_ComparisonWindowSet(0, threshold);
+        ADC1_WindowModeSet(ADC_WINMODE_LESS_THAN_WINUT);
+        ADC1_InterruptsClear(ADC_STATUS_WINMON);
+        ADC1_InterruptsEnable(ADC_STATUS_WINMON);
+    }
+    ADC1_ConversionStart();
+    while(!ADC1_ConversionStatusGet());
+    if(threshold){
+        ADC1_InterruptsDisable(ADC_STATUS_WINMON);
+        ADC1_WindowModeSet(ADC_WINMODE_DISABLED);
+    }
     
+    // Translate in 0.1V/unit 
+    int val = (int) ADC1_ConversionResultGet() * 33 * 8 / 255;
+    if(val>255) val = 255;
     
-    if(deviceStruct.sensors.needle_id < 102) needle_stat = NEEDLE_UNDETECTED;
-    else if(deviceStruct.sensors.needle_id < 127) needle_stat = NEEDLE_A;
-    else if(deviceStruct.sensors.needle_id < 200) needle_stat = NEEDLE_B;
-    else{
-        
-        // If the Needle disable signal is present it means that the adapter is connected,
-        // then this code is C. If the Needle disable signal, is not present then the 
-        // adapter is not connected
-        if(deviceStruct.needle_disable_stat){
-             // The adapter is present
-            needle_stat = NEEDLE_C;
-        }else{
-            needle_stat = NEEDLE_DISCONNECTED;
+    if(filter < 0) filter = val * 4;
+    else filter += val - (filter >> 2);
+    
+    deviceStruct.sensors.power_supply = (unsigned char) (filter >> 2);
+    StatusAnalogRegister.MOTOR_POWER = deviceStruct.sensors.power_supply;
+    return;
+}
+
+/**
+ * This function acquires the supply monitor channels.
+ * 
+ * The function is called every 7.8ms:
+ * + ANL_REFERENCE_12V (ADC0 AIN1) and ANL_REFERENCE_5VEXT (ADC0 AIN4)
+ * are reported in 8 bit ADC units;
+ * + the POWER_OK digital input.
+ * 
+ * The values are published in the Monitor Status register.
+ */
+void MonitorDetection(){
+    deviceStruct.sensors.ref_12v = (int) Adc0Convert(ADC_POSINPUT_AIN1) >> 4;
+    deviceStruct.sensors.ref_5vext = (int) Adc0Convert(ADC_POSINPUT_AIN4) >> 4;
+    
+    deviceStruct.sensors.power_ok = (uc_POWER_OK_Get() != 0U);
+    
+    StatusMonitorRegister.REF_12V = (unsigned char) deviceStruct.sensors.ref_12v;
+    StatusMonitorRegister.REF_5VEXT = (unsigned char) deviceStruct.sensors.ref_5vext;
+    StatusMonitorRegister.power_ok = deviceStruct.sensors.power_ok;
+    return;
+}
+
+/**
+ * \ingroup MOTMOD
+ * This function converts an ADC0 channel.
+ * 
+ * When the position window is armed (see PositionWindowStart()):
+ * + the position channel returns the next free running conversion;
+ * + the other channels suspend the free running conversion and the window
+ * for the time of a single conversion.
+ * 
+ * @param input ADC0 channel
+ * @return the conversion result
+ */
+static uint16_t HOT_CODE Adc0Convert(ADC_POSINPUT input){
+    uint16_t result;
+    
+    if(positionWindow.active){
+        if(input == positionWindow.input){
+            while(!ADC0_ConversionStatusGet());
+            return ADC0_ConversionResultGet();
         }
+        Adc0WindowSuspend();
+    }else{
+        Adc0SamplerHold();
     }
     
+    ADC0_ChannelSelect( input, ADC_NEGINPUT_GND );
+    ADC0_ConversionStart();
+    while(!ADC0_ConversionStatusGet());
+    result = ADC0_ConversionResultGet();
+    
+    if(positionWindow.active) Adc0WindowResume();
+    else Adc0SamplerRelease();
+    return result;
+}
+
+/**
+ * \ingroup MOTMOD
+ * This function suspends the RTC triggered position sampling.
+ * 
+ * The START event is disconnected, then a triggered conversion in progress
+ * is completed and stored by the RESRDY interrupt before the ADC0 is released
+ * to the caller (single conversions or free running window).
+ */
+static void Adc0SamplerHold(void){
+    EVSYS_REGS->EVSYS_USER[EVENT_ID_USER_ADC0_START] = 0;
+    while(ADC0_REGS->ADC_STATUS & ADC_STATUS_ADCBUSY_Msk);
+    while(ADC0_ConversionStatusGet());
+    ADC0_InterruptsDisable(ADC_STATUS_RESRDY);
+}
+
+/**
+ * \ingroup MOTMOD
+ * This function resumes the RTC triggered position sampling:
+ * the channel of the next sampled axis is selected and the START event reconnected.
+ */
+static void Adc0SamplerRelease(void){
+    ADC0_ChannelSelect( positionInput[positionSampler.axis], ADC_NEGINPUT_GND );
+    ADC0_InterruptsClear(ADC_STATUS_RESRDY);
+    ADC0_InterruptsEnable(ADC_STATUS_RESRDY);
+    EVSYS_REGS->EVSYS_USER[EVENT_ID_USER_ADC0_START] = EVSYS_USER_CHANNEL(POSITION_SAMPLE_CHANNEL);
+}
+
+/**
+ * \ingroup MOTMOD
+ * This function starts the RTC triggered position sampling.
+ * 
+ * The RTC PER0 event (7.8125ms) is routed by the EVSYS (channel 2, see EVSYS_Initialize())
+ * to the ADC0 START input: the conversion starts in hardware at the RTC period,
+ * independently from the main loop activity.
+ * The position channels are sampled in round robin (every axis every 23.4ms).
+ */
+static void PositionSamplerInit(void){
+    positionSampler.axis = CALIB_AXIS_X;
+    for(int i = 0; i < CALIB_AXES; i++) positionSampler.sample[i].fresh = false;
+    Adc0SamplerRelease();
+}
+
+/**
+ * \ingroup MOTMOD
+ * This function stores a position sample with its time.
+ * 
+ * The conversion has been started by the RTC PER0 event less than 
+ * half period before: the sample time is the RTC counter rounded 
+ * to the period boundary (the PER0 event is generated every \ref POSITION_SAMPLE_PERIOD counts).
+ * 
+ * @param ax sampled axis
+ * @param raw conversion result
+ */
+static void PositionSampleStore(CALIB_AXIS_t ax, uint16_t raw){
+    uint32_t time = RTC_Timer32CounterGet() + (POSITION_SAMPLE_PERIOD / 2);
     
-    // Detects the change in the current status
-    if((StatusModeRegister.needle_code == needle_stat)){
-         debounce = NEEDLE_DEBOUNCE;
-         return;
-    }         
-    debounce--;     
+    positionSampler.sample[ax].time = time & ~((uint32_t) POSITION_SAMPLE_PERIOD - 1);
+    positionSampler.sample[ax].raw = raw;
+    positionSampler.sample[ax].fresh = true;
+}
+
+/**
+ * \ingroup MOTMOD
+ * This is the ADC0 RESRDY interrupt handler (RTC triggered conversion completed).
+ * 
+ * The sample is stored and the channel of the next axis is selected
+ * for the next RTC event.
+ */
+void ADC0_RESRDY_Handler(void){
+    PositionSampleStore(positionSampler.axis, ADC0_ConversionResultGet());
+    ADC0_InterruptsClear(ADC_STATUS_RESRDY);
     
-    // Change the status
-    if(debounce == 0){
-        StatusModeRegister.needle_code = needle_stat;
-        debounce = NEEDLE_DEBOUNCE;
-        
-        // Buzzer Sound Here
-        return;
-    }
+    positionSampler.axis = (positionSampler.axis + 1) % CALIB_AXES;
+    ADC0_ChannelSelect( positionInput[positionSampler.axis], ADC_NEGINPUT_GND );
+}
+
+/**
+ * \ingroup MOTMOD
+ * This function consumes the last position sample of an axis.
+ * 
+ * The position data of the axis (sensor, position and time) are updated
+ * as with GetX(), GetY() or GetZ(), but without a conversion:
+ * the position refers to the sample time, at the fixed RTC period.
+ * 
+ * @param ax axis
+ * @return true if a new sample was available, false if the position has not been updated
+ */
+bool HOT_CODE PositionSampleGet(CALIB_AXIS_t ax){
+    uint32_t time;
+    uint16_t raw;
     
+    if(ax >= CALIB_AXES) return false;
     
-    return;
+    bool irq = NVIC_INT_Disable();
+    bool fresh = positionSampler.sample[ax].fresh;
+    time = positionSampler.sample[ax].time;
+    raw = positionSampler.sample[ax].raw;
+    positionSampler.sample[ax].fresh = false;
+    NVIC_INT_Restore(irq);
     
+    if(!fresh) return false;
+    PositionUpdate(ax, raw, time);
+    return true;
 }
 
+/**
+ * \ingroup MOTMOD
+ * This function stops the free running conversion and disables the window comparator.
+ * 
+ * The ADC0 is disabled in order to abort a pending conversion.
+ * The RTC interrupt does not sample the ADC0 result until the resume.
+ */
+static void Adc0WindowSuspend(void){
+    positionWindow.suspended = true;
+    ADC0_InterruptsDisable(ADC_STATUS_WINMON);
+    ADC0_Disable();
+    ADC0_REGS->ADC_CTRLB &= (uint16_t) ~ADC_CTRLB_FREERUN_Msk;
+    ADC0_WindowModeSet(ADC_WINMODE_DISABLED);
+    ADC0_Enable();
+    ADC0_InterruptsClear(ADC_STATUS_RESRDY | ADC_STATUS_WINMON);
+}
 
 /**
+ * \ingroup MOTMOD
+ * This function starts the free running conversion of the position channel
+ * with the window comparator set to the target band.
+ */
+static void Adc0WindowResume(void){
+    ADC0_ChannelSelect( positionWindow.input, ADC_NEGINPUT_GND );
+    ADC0_ComparisonWindowSet(positionWindow.low, positionWindow.high);
+    ADC0_WindowModeSet(ADC_WINMODE_BETWEEN_WINLT_AND_WINUT);
+    ADC0_REGS->ADC_CTRLB |= ADC_CTRLB_FREERUN_Msk;
+    while(ADC0_REGS->ADC_SYNCBUSY);
+    ADC0_InterruptsClear(ADC_STATUS_RESRDY | ADC_STATUS_WINMON);
+    ADC0_InterruptsEnable(ADC_STATUS_WINMON);
+    ADC0_ConversionStart();
+    positionWindow.suspended = false;
+}
+
+/**
+ * \ingroup MOTMOD
+ * This function arms the position window of a motor activation.
  * 
- * Convertion factor 1V -> 0.125V
+ * The position channel of the axis is converted in free running mode
+ * (a conversion every 7us) and the ADC0 window comparator is set to the 
+ * target band (target +/- \ref POSITION_WINDOW_BAND, excluded).
+ * When a conversion falls into the band, the WINMON interrupt
+ * stops the motor (see the \ref MOTMOD module).
+ * 
+ * The window is not armed if the band is out of the linearization table.
+ * 
+ * @param ax axis to be moved
+ * @param target_dm target position (0.1mm)
+ * @return true if the window has been armed
  */
-void MotorPowerSupplyDetection(){
-    ADC1_ChannelSelect( ADC_POSINPUT_AIN9, ADC_NEGINPUT_GND );
-    ADC1_ConversionStart();
-    while(!ADC1_ConversionStatusGet());
+bool PositionWindowStart(CALIB_AXIS_t ax, int target_dm){
+    int u0, u1, tmp;
     
-    // Translate in 0.1V/unit 
-    int val = (int) ADC1_ConversionResultGet() * 33 * 8 / 255;
-    if(val>255) val = 255;
+    PositionWindowStop();
+    if(ax >= CALIB_AXES) return false;
     
-    deviceStruct.sensors.power_supply = (unsigned char) val;
-    StatusAnalogRegister.MOTOR_POWER = deviceStruct.sensors.power_supply;
-    return;
+    u0 = calibUnits(ax, target_dm - POSITION_WINDOW_BAND);
+    u1 = calibUnits(ax, target_dm + POSITION_WINDOW_BAND);
+    if((u0 < 0) || (u1 < 0)) return false;
+    if(u0 > u1){ tmp = u0; u0 = u1; u1 = tmp; }
+    
+    u0 += calibStruct.axis[ax].offset;
+    u1 += calibStruct.axis[ax].offset;
+    if(u0 < 0) u0 = 0;
+    if(u1 > 0xFFF) u1 = 0xFFF;
+    if(u0 >= u1) return false;
+    
+    Adc0SamplerHold();
+    positionWindow.axis = ax;
+    positionWindow.input = positionInput[ax];
+    positionWindow.low = (uint16_t) u0;
+    positionWindow.high = (uint16_t) u1;
+    positionWindow.active = true;
+    Adc0WindowResume();
+    return true;
+}
+
+/**
+ * \ingroup MOTMOD
+ * This function disarms the position window: 
+ * the ADC0 returns to the single conversion mode.
+ */
+void PositionWindowStop(void){
+    if(!positionWindow.active) return;
+    positionWindow.active = false;
+    Adc0WindowSuspend();
+    Adc0SamplerRelease();
 }
 
-void GetSHSensor(){  
+void HOT_CODE GetSHSensor(){  
     
     // No detection if the needle is disconnected
     if(StatusModeRegister.needle_code == NEEDLE_DISCONNECTED){
@@ -340,10 +830,7 @@ void GetSHSensor(){
         return;
     }
     
-    ADC0_ChannelSelect( ADC_POSINPUT_AIN0, ADC_NEGINPUT_GND );
-    ADC0_ConversionStart();
-    while(!ADC0_ConversionStatusGet());    
-    deviceStruct.sensors.sh = (int) ADC0_ConversionResultGet();
+    deviceStruct.sensors.sh = (int) Adc0Convert(ADC_POSINPUT_AIN0);
     
     int val = deviceStruct.sensors.sh;
     if(val<0) val = 0;
@@ -352,28 +839,63 @@ void GetSHSensor(){
     return;
 }
 
+/**
+ * \ingroup MOTMOD
+ * This function updates the position data of an axis.
+ * 
+ * The position is calibrated with the offset and the linearization table (see \ref CALIBMOD)
+ * and published in the position STATUS register.
+ * 
+ * @param ax axis
+ * @param raw conversion result of the position channel
+ * @param time time of the conversion (RTC counter, 1/1024s units)
+ */
+static void HOT_CODE PositionUpdate(CALIB_AXIS_t ax, int raw, uint32_t time){
+    int val;
+    
+    deviceStruct.pointer.time = time;
+    
+    if(ax == CALIB_AXIS_X){
+        deviceStruct.sensors.x = raw - calibStruct.axis[CALIB_AXIS_X].offset;
+        deviceStruct.pointer.pos = deviceStruct.pointer.xdm = calibPosition(CALIB_AXIS_X, deviceStruct.sensors.x);
+        
+        val = deviceStruct.pointer.xdm;
+        if(val<0) val = 0;
+        StatusXYPositionRegister.XL = (unsigned char) (val & 0x00FF);
+        StatusXYPositionRegister.XH = (unsigned char) ((val >> 8) & 0x00FF);
+    }else if(ax == CALIB_AXIS_Y){
+        deviceStruct.sensors.y = raw - calibStruct.axis[CALIB_AXIS_Y].offset;
+        deviceStruct.pointer.pos = deviceStruct.pointer.ydm = calibPosition(CALIB_AXIS_Y, deviceStruct.sensors.y);
+        
+        val = deviceStruct.pointer.ydm;
+        if(val<0) val = 0;
+        StatusXYPositionRegister.YL = (unsigned char) (val & 0x00FF);
+        StatusXYPositionRegister.YH = (unsigned char) ((val >> 8) & 0x00FF);
+    }else{
+        deviceStruct.sensors.z = raw - calibStruct.axis[CALIB_AXIS_Z].offset;
+        deviceStruct.pointer.pos = deviceStruct.pointer.zdm = calibPosition(CALIB_AXIS_Z, deviceStruct.sensors.z);
+        
+        val = deviceStruct.pointer.zdm;
+        if(val<0) val = 0;
+        StatusZPositionRegister.ZL = (unsigned char) (val & 0x00FF);
+        StatusZPositionRegister.ZH = (unsigned char) ((val >> 8) & 0x00FF);
+    }
+    return;
+}
+
 /**
  * \ingroup MOTMOD
  * 
  * This function converts the X position sensor 
  * and convert it into the position units.
  * 
- * The position shall be calibrated with the hardware trimmers on the board.
  * According with the ADC0 module setting, the routine takes about 7us to completes.
  */
-void GetX(void){
-    
-    ADC0_ChannelSelect( ADC_POSINPUT_AIN5, ADC_NEGINPUT_GND );
-    ADC0_ConversionStart();
-    while(!ADC0_ConversionStatusGet());
-    deviceStruct.sensors.x = (int) ADC0_ConversionResultGet() - 50;
-    deviceStruct.pointer.pos = deviceStruct.pointer.xdm = X_To_dm(deviceStruct.sensors.x);
-    
-    int val = deviceStruct.pointer.xdm;
-    if(val<0) val = 0;
-    StatusXYPositionRegister.XL = (unsigned char) (val & 0x00FF);
-    StatusXYPositionRegister.XH = (unsigned char) ((val >> 8) & 0x00FF);
+void HOT_CODE GetX(void){
     
+    PROFILE_BEGIN(PROFILE_GET_X);
+    PositionUpdate(CALIB_AXIS_X, (int) Adc0Convert(ADC_POSINPUT_AIN5), RTC_Timer32CounterGet());
+    PROFILE_END(PROFILE_GET_X);
     return;
 }
 
@@ -382,22 +904,13 @@ void GetX(void){
  * This function converts the Y position sensor 
  * and convert it into the position units.
  * 
- * The position shall be calibrated with the hardware trimmers on the board.
  * According with the ADC0 module setting, the routine takes about 7us to completes. 
  */
-void GetY(void){
-    
-    ADC0_ChannelSelect( ADC_POSINPUT_AIN6, ADC_NEGINPUT_GND );
-    ADC0_ConversionStart();
-    while(!ADC0_ConversionStatusGet());
-    deviceStruct.sensors.y = (int) ADC0_ConversionResultGet() - 50;
-    deviceStruct.pointer.pos = deviceStruct.pointer.ydm = Y_To_dm(deviceStruct.sensors.y);
-    
-    int val = deviceStruct.pointer.ydm;
-    if(val<0) val = 0;
-    StatusXYPositionRegister.YL = (unsigned char) (val & 0x00FF);
-    StatusXYPositionRegister.YH = (unsigned char) ((val >> 8) & 0x00FF);
+void HOT_CODE GetY(void){
     
+    PROFILE_BEGIN(PROFILE_GET_Y);
+    PositionUpdate(CALIB_AXIS_Y, (int) Adc0Convert(ADC_POSINPUT_AIN6), RTC_Timer32CounterGet());
+    PROFILE_END(PROFILE_GET_Y);
     return;
 }
 
@@ -406,33 +919,28 @@ void GetY(void){
  * This function converts the Z position sensor 
  * and convert it into the position units.
  * 
- * The position shall be calibrated with the hardware trimmers on the board.
  * According with the ADC0 module setting, the routine takes about 7us to completes.
  */
-void GetZ(void){    
-    ADC0_ChannelSelect( ADC_POSINPUT_AIN7, ADC_NEGINPUT_GND );
-    ADC0_ConversionStart();
-    while(!ADC0_ConversionStatusGet());    
-    deviceStruct.sensors.z = (int) ADC0_ConversionResultGet() - 50;
-    deviceStruct.pointer.pos = deviceStruct.pointer.zdm = Z_To_dm(deviceStruct.sensors.z);
-    
-    int  val = deviceStruct.pointer.zdm;
-    if(val<0) val = 0;
-    StatusZPositionRegister.ZL = (unsigned char) (val & 0x00FF);
-    StatusZPositionRegister.ZH = (unsigned char) ((val >> 8) & 0x00FF);
-    
+void HOT_CODE GetZ(void){    
+    PROFILE_BEGIN(PROFILE_GET_Z);
+    PositionUpdate(CALIB_AXIS_Z, (int) Adc0Convert(ADC_POSINPUT_AIN7), RTC_Timer32CounterGet());
+    PROFILE_END(PROFILE_GET_Z);
     return;
 }
 
-void KeyboardHandler(void){
-    
-    // Upgrades the current keyboard hardware status
-    deviceStruct.keyboard.hw.xp =  !uc_BUTTON_XP_Get();
-    deviceStruct.keyboard.hw.xm =  !uc_BUTTON_XM_Get();
-    deviceStruct.keyboard.hw.yp =  !uc_BUTTON_YP_Get();
-    deviceStruct.keyboard.hw.ym =  !uc_BUTTON_YM_Get();
-    deviceStruct.keyboard.hw.zp =  !uc_BUTTON_ZP_Get();
-    deviceStruct.keyboard.hw.zm =  !uc_BUTTON_ZM_Get();
+/**
+ * This function upgrades the keyboard buttons status.
+ * 
+ * The buttons are read from the EIC debounced pin state
+ * (active low inputs, see KeyboardInit()).
+ */
+static void KeyboardKeysUpdate(void){
+    deviceStruct.keyboard.hw.xp =  !EIC_PinStateGet(KEY_EIC_XP);
+    deviceStruct.keyboard.hw.xm =  !EIC_PinStateGet(KEY_EIC_XM);
+    deviceStruct.keyboard.hw.yp =  !EIC_PinStateGet(KEY_EIC_YP);
+    deviceStruct.keyboard.hw.ym =  !EIC_PinStateGet(KEY_EIC_YM);
+    deviceStruct.keyboard.hw.zp =  !EIC_PinStateGet(KEY_EIC_ZP);
+    deviceStruct.keyboard.hw.zm =  !EIC_PinStateGet(KEY_EIC_ZM);
     StatusAnalogRegister.KEYBOARD = *((unsigned char*) &deviceStruct.keyboard.hw);
     
     // Upgrade the flags
@@ -440,6 +948,66 @@ void KeyboardHandler(void){
         deviceStruct.keyboard.flags.key_present = true;
     else 
         deviceStruct.keyboard.flags.key_present = false;       
+}
+
+/**
+ * This is the callback of the keyboard EIC lines.
+ * 
+ * The EIC generates the interrupt on both the edges of the debounced buttons:
+ * the keyboard status is upgraded immediately and the release of all the buttons 
+ * stops a key requested activation (see motorKeyReleased()).
+ * 
+ * @param context not used
+ */
+static void KeyboardEventHandler(uintptr_t context){
+    KeyboardKeysUpdate();
+    if(!deviceStruct.keyboard.flags.key_present) motorKeyReleased();
+}
+
+/**
+ * This function registers the keyboard EIC callbacks.
+ * 
+ * The buttons (PA14 to PA19) are routed to the EIC lines 14, 15 and 0 to 3
+ * with the debouncer enabled: 7 stable samples at 1.024kHz (about 7ms, see EIC_Initialize()).
+ */
+static void KeyboardInit(void){
+    EIC_CallbackRegister(KEY_EIC_XP, KeyboardEventHandler, 0);
+    EIC_CallbackRegister(KEY_EIC_XM, KeyboardEventHandler, 0);
+    EIC_CallbackRegister(KEY_EIC_YP, KeyboardEventHandler, 0);
+    EIC_CallbackRegister(KEY_EIC_YM, KeyboardEventHandler, 0);
+    EIC_CallbackRegister(KEY_EIC_ZP, KeyboardEventHandler, 0);
+    EIC_CallbackRegister(KEY_EIC_ZM, KeyboardEventHandler, 0);
+}
+
+/**
+ * This function returns the EVSYS generator of the pressed button.
+ * 
+ * It is used by the CCL interlock (see motorStopChainArm()): the EIC event 
+ * of the button line (EVCTRL enabled for the keyboard lines, see EIC_Initialize())
+ * is routed to the CCL in order to stop the activation at the release of the button.
+ * 
+ * @return the generator of the EIC line of the pressed button (EVENT_ID_GEN_EIC_EXTINT_n),
+ * 0 if no button or more than one button is pressed
+ */
+uint8_t KeyboardEventGenerator(void){
+    static const EIC_PIN keyLine[] = {KEY_EIC_XP, KEY_EIC_XM, KEY_EIC_YP, KEY_EIC_YM, KEY_EIC_ZP, KEY_EIC_ZM};
+    unsigned keys = *((unsigned char*) &deviceStruct.keyboard.hw) & 0x3F;
+    
+    if((keys == 0) || (keys & (keys - 1))) return 0;
+    return (uint8_t) (EVENT_ID_GEN_EIC_EXTINT_0 + keyLine[__builtin_ctz(keys)]);
+}
+
+/**
+ * This function upgrades the keyboard status every 128ms.
+ * 
+ * The buttons status is upgraded by the EIC interrupts:
+ * it is read here again only to recover a lost edge.
+ */
+void KeyboardHandler(void){
+    
+    bool irq = NVIC_INT_Disable();
+    KeyboardKeysUpdate();
+    NVIC_INT_Restore(irq);
     
     if(uc_BUTTON_ENA_Get()) deviceStruct.keyboard.flags.keyboard_enable_stat = true;
     else deviceStruct.keyboard.flags.keyboard_enable_stat = false;
@@ -447,6 +1015,111 @@ void KeyboardHandler(void){
     
 }
 
+/**
+ * This function records an edge of a safety feedback input.
+ * 
+ * + The input status is upgraded into the device and the MODE STATUS register;
+ * + The edge is counted and the duration of the previous level (pulse) is measured
+ * with the DWT cycle counter, into the SAFETY FEEDBACK STATUS register;
+ * + The edge is recorded in the event trace with the pulse duration (TRACE_SAFETY_EDGE);
+ * + A drop of the motor power switch stops the pending activation (see motorPowerSwitchDropped()).
+ * 
+ * @param in safety feedback input
+ * @param level new level of the input
+ * @param width duration of the previous level (0.1ms units, saturated)
+ */
+static void SafetyFeedbackEdge(SAFETY_INPUT_t in, bool level, uint32_t width){
+    if(safetyFeedback[in].edges < 255) safetyFeedback[in].edges++;
+    
+    // Shortest pulse: a merged pulse (width 0) is reported as 0.1ms 
+    uint8_t pulse = (width == 0) ? 1 : (width > 255) ? 255 : (uint8_t) width;
+    if((safetyFeedback[in].edges > 1) && ((safetyFeedback[in].min_pulse == 0) || (pulse < safetyFeedback[in].min_pulse))){
+        safetyFeedback[in].min_pulse = pulse;
+    }
+    safetyFeedback[in].level = level;
+    
+    if(width > 0xFFFF) width = 0xFFFF;
+    traceEvent(TRACE_SAFETY_EDGE, (uint8_t) in, (uint8_t) level, (uint8_t) (width & 0xFF), (uint8_t) ((width >> 8) & 0xFF));
+    
+    if(in == SAFETY_MOTOR){
+        StatusModeRegister.power_sw_status = deviceStruct.power_sw_stat = level;
+        StatusSafetyRegister.ME = safetyFeedback[in].edges;
+        StatusSafetyRegister.MP = safetyFeedback[in].min_pulse;
+        if(!level) motorPowerSwitchDropped();
+    }else{
+        StatusModeRegister.power_sw_needle_disable = deviceStruct.needle_disable_stat = level;
+        StatusSafetyRegister.NE = safetyFeedback[in].edges;
+        StatusSafetyRegister.NP = safetyFeedback[in].min_pulse;
+    }
+}
+
+/**
+ * This is the callback of the safety feedback EIC lines.
+ * 
+ * The EIC generates the interrupt on both the edges of the inputs (without debouncer).
+ * If the input is found at the previous level, a pulse shorter than 
+ * the interrupt latency has been detected: both the edges are recorded.
+ * 
+ * @param context safety feedback input (SAFETY_INPUT_t)
+ */
+static void SafetyFeedbackEventHandler(uintptr_t context){
+    SAFETY_INPUT_t in = (SAFETY_INPUT_t) context;
+    uint32_t cycles = DWT->CYCCNT;
+    uint32_t time = RTC_Timer32CounterGet();
+    bool level = (in == SAFETY_MOTOR) ? uc_MOTOR_ENA_FEEDBACK_Get() : uc_NEEDLE_ENA_FEEDBACK_Get();
+    uint32_t width;
+    
+    if(time - safetyFeedback[in].time > SAFETY_PULSE_MAX_s * 1024) width = 0xFFFF;
+    else width = (cycles - safetyFeedback[in].cycles) / (CPU_CLOCK_FREQUENCY / 10000);
+    safetyFeedback[in].cycles = cycles;
+    safetyFeedback[in].time = time;
+    
+    if(level == safetyFeedback[in].level){
+        SafetyFeedbackEdge(in, !level, width);
+        width = 0;
+    }
+    SafetyFeedbackEdge(in, level, width);
+}
+
+/**
+ * This function initializes the safety feedback monitoring.
+ * 
+ * The MOTOR_ENA_FEEDBACK (PA10) and NEEDLE_ENA_FEEDBACK (PA11) inputs 
+ * are routed to the EIC lines 10 and 11, with the interrupt on both the edges
+ * and without debouncer (see EIC_Initialize()): the pulses longer than 
+ * the EIC clock period (ULP32K, about 30us) are detected.
+ * Before, the inputs were sampled only at the end of the motor loop
+ * and every 128ms.
+ */
+static void SafetyFeedbackInit(void){
+    for(int i = 0; i < SAFETY_INPUTS; i++){
+        safetyFeedback[i].cycles = DWT->CYCCNT;
+        safetyFeedback[i].time = RTC_Timer32CounterGet();
+        safetyFeedback[i].edges = 0;
+        safetyFeedback[i].min_pulse = 0;
+    }
+    safetyFeedback[SAFETY_MOTOR].level = uc_MOTOR_ENA_FEEDBACK_Get();
+    safetyFeedback[SAFETY_NEEDLE].level = uc_NEEDLE_ENA_FEEDBACK_Get();
+    StatusModeRegister.power_sw_status = deviceStruct.power_sw_stat = safetyFeedback[SAFETY_MOTOR].level;
+    StatusModeRegister.power_sw_needle_disable = deviceStruct.needle_disable_stat = safetyFeedback[SAFETY_NEEDLE].level;
+    
+    EIC_CallbackRegister(SAFETY_EIC_MOTOR, SafetyFeedbackEventHandler, (uintptr_t) SAFETY_MOTOR);
+    EIC_CallbackRegister(SAFETY_EIC_NEEDLE, SafetyFeedbackEventHandler, (uintptr_t) SAFETY_NEEDLE);
+}
+
+/**
+ * This function checks the safety feedback inputs every 128ms.
+ * 
+ * The inputs are upgraded by the EIC interrupts:
+ * they are read here again only to recover a lost edge.
+ */
+static void SafetyFeedbackHandler(void){
+    bool irq = NVIC_INT_Disable();
+    if(uc_MOTOR_ENA_FEEDBACK_Get() != safetyFeedback[SAFETY_MOTOR].level) SafetyFeedbackEventHandler((uintptr_t) SAFETY_MOTOR);
+    if(uc_NEEDLE_ENA_FEEDBACK_Get() != safetyFeedback[SAFETY_NEEDLE].level) SafetyFeedbackEventHandler((uintptr_t) SAFETY_NEEDLE);
+    NVIC_INT_Restore(irq);
+}
+
 void SetKeyMode(bool enable, bool step_mode){
     
     // Enabling the Power Switch control
@@ -478,45 +1151,207 @@ void SetPowerSwitchStat(bool stat){
     return;
 }
 
+/**
+ * This function initializes the buzzer pattern generator.
+ *
+ * The BUZZER pin (PB22) has no TC/TCC waveform output:
+ * the TC0 compare match event toggles the pin through the EVSYS channel 6
+ * and the PORT event input 3, so the pattern timing does not depend on the CPU.
+ * The TC0 match interrupt only preloads the length of the next segment
+ * (buffered period) and starts the next pending pattern.
+ */
 void BuzzerInit(void){
-    buzzerStruct.num_pulses = 0;
-    buzzerStruct.status = false;
-    buzzerStruct.timer = 0;
+    TC0_CompareStop();
     BUZZER_Clear();
+    
+    PORT_REGS->GROUP[1].PORT_EVCTRL = 0;
+    PORT_REGS->GROUP[1].PORT_EVCTRL = PORT_EVCTRL_PID3(BUZZER_PIN & 0x1FU) | PORT_EVCTRL_EVACT3(PORT_EVCTRL_EVACT0_TGL_Val);
+    
+    buzzerStruct.status = false;
+    buzzerStruct.queued = 0;
+    TC0_CompareCallbackRegister(BuzzerSegmentCallback, 0);
 }
-void BuzzerSet(int pulses, int ton, int toff){
-    if(buzzerStruct.status) return;
-    if(pulses <=0) return;
+
+/// Converts a pattern time (15.625ms units) into the TC0 period of a segment
+static uint16_t BuzzerSegmentPeriod(unsigned segment){
+    unsigned t = (segment & 1U) ? buzzerStruct.pattern.toff : buzzerStruct.pattern.ton;
+    return (uint16_t) ((t * BUZZER_UNIT_us + BUZZER_TICK_us / 2) / BUZZER_TICK_us - 1);
+}
+
+/**
+ * This function starts a pattern from the ON segment.
+ * 
+ * A playing pattern is interrupted.
+ * 
+ * \note The function shall be called with the TC0 interrupt disabled
+ * or from the TC0 interrupt.
+ * 
+ * @param pattern pattern to be played
+ */
+static void BuzzerPlay(const BUZZER_PATTERN_t* pattern){
+    TC0_CompareStop();
+    PORT_REGS->GROUP[1].PORT_EVCTRL &= ~PORT_EVCTRL_PORTEI3_Msk;
+    TC0_REGS->COUNT16.TC_INTFLAG = (uint8_t) TC_INTFLAG_Msk;
+    NVIC_ClearPendingIRQ(TC0_IRQn);
     
-    buzzerStruct.timer = 0;
-    buzzerStruct.ton=ton;
-    buzzerStruct.toff=toff;
-    buzzerStruct.num_pulses=pulses;
+    buzzerStruct.pattern = *pattern;
+    buzzerStruct.segment = 0;
     buzzerStruct.status = true;
-    return;
+    
+    // The first segment is loaded immediately, the second is buffered
+    TC0_Compare16bitCounterSet(0);
+    TC0_Compare16bitPeriodLoad(BuzzerSegmentPeriod(0));
+    TC0_Compare16bitPeriodSet(BuzzerSegmentPeriod(1));
+    
+    BUZZER_Set();
+    PORT_REGS->GROUP[1].PORT_EVCTRL |= PORT_EVCTRL_PORTEI3_Msk;
+    TC0_CompareStart();
 }
 
-void Buzzerhandle(void){
+/// Stops the pattern generator
+static void BuzzerStop(void){
+    TC0_CompareStop();
+    PORT_REGS->GROUP[1].PORT_EVCTRL &= ~PORT_EVCTRL_PORTEI3_Msk;
+    BUZZER_Clear();
+    buzzerStruct.status = false;
+}
+
+/**
+ * This function inserts a pattern into the queue.
+ * 
+ * The queue is sorted by priority (FIFO within the same priority).
+ * With a full queue the newest pattern of the lowest priority is dropped.
+ * 
+ * @param pattern pattern to be queued
+ * @param front true to insert the pattern before the ones of the same priority
+ * @return true if the pattern has been queued
+ */
+static bool BuzzerQueuePush(const BUZZER_PATTERN_t* pattern, bool front){
+    unsigned i;
+    
+    if(buzzerStruct.queued == BUZZER_QUEUE_SIZE){
+        if(pattern->priority <= buzzerStruct.queue[BUZZER_QUEUE_SIZE - 1].priority) return false;
+        buzzerStruct.queued--;
+    }
     
-    if(!buzzerStruct.status){ 
-        BUZZER_Clear();
+    for(i = buzzerStruct.queued; i > 0; i--){
+        uint8_t priority = buzzerStruct.queue[i - 1].priority;
+        if((priority > pattern->priority) || ((priority == pattern->priority) && !front)) break;
+        buzzerStruct.queue[i] = buzzerStruct.queue[i - 1];
+    }
+    
+    buzzerStruct.queue[i] = *pattern;
+    buzzerStruct.queued++;
+    return true;
+}
+
+/// Removes the first pattern from the queue
+static BUZZER_PATTERN_t BuzzerQueuePop(void){
+    BUZZER_PATTERN_t pattern = buzzerStruct.queue[0];
+    
+    buzzerStruct.queued--;
+    for(unsigned i = 0; i < buzzerStruct.queued; i++) buzzerStruct.queue[i] = buzzerStruct.queue[i + 1];
+    return pattern;
+}
+
+/// Returns true if a pattern sounds as the requested one with an equal or higher priority
+static bool BuzzerPatternCovers(const BUZZER_PATTERN_t* p, const BUZZER_PATTERN_t* pattern){
+    return (p->pulses == pattern->pulses) && (p->ton == pattern->ton) &&
+           (p->toff == pattern->toff) && (p->priority >= pattern->priority);
+}
+
+/// Returns true if the requested pattern is already playing or queued
+static bool BuzzerPatternPending(const BUZZER_PATTERN_t* pattern){
+    if(buzzerStruct.status && BuzzerPatternCovers(&buzzerStruct.pattern, pattern)) return true;
+    
+    for(unsigned i = 0; i < buzzerStruct.queued; i++){
+        if(BuzzerPatternCovers(&buzzerStruct.queue[i], pattern)) return true;
+    }
+    return false;
+}
+
+/**
+ * This function is the TC0 compare match callback: a new segment is started.
+ * 
+ * The length of the started segment has been loaded from the period buffer
+ * at the match: the buffer is loaded with the following one.
+ * The last OFF segment ends without toggling the pin;
+ * at the end of the pattern the next pending pattern is started.
+ */
+static void BuzzerSegmentCallback(TC_COMPARE_STATUS status, uintptr_t context){
+    unsigned segments = 2U * buzzerStruct.pattern.pulses;
+    unsigned segment;
+    
+    if(!buzzerStruct.status || !(status & TC_COMPARE_STATUS_MATCH0)) return;
+    segment = ++buzzerStruct.segment;
+    
+    if(segment >= segments){
+        if(buzzerStruct.queued){
+            BUZZER_PATTERN_t next = BuzzerQueuePop();
+            BuzzerPlay(&next);
+        }else BuzzerStop();
         return;
     }
     
-    if(buzzerStruct.timer < buzzerStruct.ton){
-        BUZZER_Set();
-    }else if(buzzerStruct.timer < buzzerStruct.ton + buzzerStruct.toff){
-        BUZZER_Clear();
+    if(segment == segments - 1U) PORT_REGS->GROUP[1].PORT_EVCTRL &= ~PORT_EVCTRL_PORTEI3_Msk;
+    TC0_Compare16bitPeriodSet(BuzzerSegmentPeriod(segment + 1U));
+}
+
+/// Limits a pattern time to the 1 to 255 units range
+static uint8_t BuzzerTime(int t){
+    return (uint8_t) ((t < 1) ? 1 : (t > 255) ? 255 : t);
+}
+
+/**
+ * This function requests a buzzer pattern.
+ * 
+ * + with the buzzer idle the pattern is started immediately;
+ * + a pattern of higher priority than the playing one preempts it:
+ *  the interrupted pattern is queued again and restarts after;
+ * + otherwise the pattern is queued behind the pending ones
+ *  of the same or higher priority.
+ * 
+ * A request equal to a playing or pending pattern is ignored,
+ * so a periodic request (e.g. key hold) does not fill the queue.
+ * 
+ * @param pulses number of pulses
+ * @param ton pulse ON time (15.625ms units, 1 to 255)
+ * @param toff pulse OFF time (15.625ms units, 1 to 255)
+ * @param priority pattern priority
+ */
+void BuzzerSetPriority(int pulses, int ton, int toff, BUZZER_PRIORITY_t priority){
+    BUZZER_PATTERN_t pattern;
+    bool accepted = false;
+    
+    if(pulses <= 0) return;
+    
+    pattern.pulses = (uint8_t) ((pulses > 255) ? 255 : pulses);
+    pattern.ton = BuzzerTime(ton);
+    pattern.toff = BuzzerTime(toff);
+    pattern.priority = (uint8_t) priority;
+    
+    bool irq = NVIC_INT_Disable();
+    if(BuzzerPatternPending(&pattern)){
+        // Already playing or queued
+    }else if(!buzzerStruct.status){
+        BuzzerPlay(&pattern);
+        accepted = true;
+    }else if(pattern.priority > buzzerStruct.pattern.priority){
+        BUZZER_PATTERN_t preempted = buzzerStruct.pattern;
+        BuzzerQueuePush(&preempted, true);
+        BuzzerPlay(&pattern);
+        accepted = true;
     }else{
-        buzzerStruct.num_pulses--;
-        buzzerStruct.timer = 0;
-        
-        if(!buzzerStruct.num_pulses) buzzerStruct.status = false;
-        return;
+        accepted = BuzzerQueuePush(&pattern, false);
     }
+    NVIC_INT_Restore(irq);
     
-    buzzerStruct.timer++;
-    return;
+    if(accepted) traceEvent(TRACE_BUZZER, pattern.pulses, pattern.ton, pattern.toff, pattern.priority);
+}
+
+/// Requests a buzzer pattern of INFO priority (see BuzzerSetPriority())
+void BuzzerSet(int pulses, int ton, int toff){
+    BuzzerSetPriority(pulses, ton, toff, BUZZER_PRIORITY_INFO);
 }
 
 /** @}*/
@@ -3,6 +3,7 @@
 #define _MAIN_H
 
 #include "definitions.h"
+#include "Calibration/calibration.h"
 
 #undef ext
 #undef ext_static
@@ -18,31 +19,28 @@
 /**
  * # X-AXES PEROFORMANCES
  * 
- * Unit conversion: 1 unit = 0.1 mm. 
+ * Unit conversion: 1 unit = 0.1 mm (default calibration). 
+ * The positions are converted with calibPosition() and calibUnits() (see \ref CALIBMOD). 
  *  
  */
-#define Xdm_To_Units(dm) (int) ((dm) * 1 )
-#define X_To_dm(u) (int) (u) 
 #define DEFAULT_BUTTON_X_TRAVEL_dm 2500
 
 /**
- * # X-AXES PEROFORMANCES
+ * # Y-AXES PEROFORMANCES
  * 
- * Unit conversion: 2.5 unit = 0.1 mm. 
+ * Unit conversion: 2.5 unit = 0.1 mm (default calibration). 
+ * The positions are converted with calibPosition() and calibUnits() (see \ref CALIBMOD). 
  *  
  */
-#define Ydm_To_Units(dm) (int) (((dm) * 25) / 10 )
-#define Y_To_dm(u) (int) (u) * 10 / 25
 #define DEFAULT_BUTTON_Y_TRAVEL_dm 600
 
 /**
  * # Z-AXES PEROFORMANCES
  * 
- * Unit conversion: 2 unit = 0.1 mm. 
+ * Unit conversion: 2 unit = 0.1 mm (default calibration). 
+ * The positions are converted with calibPosition() and calibUnits() (see \ref CALIBMOD). 
  *  
  */
-#define Zdm_To_Units(dm) (int) ((dm) * 2 )
-#define Z_To_dm(u) (int) (u) / 2
 #define DEFAULT_BUTTON_Z_TRAVEL_dm 1000
 
 
@@ -50,8 +48,8 @@
 /// This is the module data structure
 typedef struct{
     bool general_enable_stat; //!< Current status of the general enable switch 
-    bool power_sw_stat;//!< Current status of the power switch
-    bool needle_disable_stat;//!< Current status of the needle disable signal
+    volatile bool power_sw_stat;//!< Current status of the power switch (safety feedback interrupt)
+    volatile bool needle_disable_stat;//!< Current status of the needle disable signal (safety feedback interrupt)
     
     /// Sensors data structure
     struct{
@@ -61,7 +59,11 @@ typedef struct{
         int sh;//!< SH position sensor
         int xscroll; //!< X-SCROLL sensor
         int needle_id; //!< Needle Id sensor
+        int yrib; //!< Y flip input (1 = Y UP)
         int power_supply;//!< Current motor voltage level
+        int ref_12v;//!< 12V reference monitor (ADC units)
+        int ref_5vext;//!< 5V external reference monitor (ADC units)
+        bool power_ok;//!< POWER_OK input status
     }sensors;
     
     struct{
@@ -69,6 +71,7 @@ typedef struct{
         int ydm; //!< Y position sensor
         int zdm; //!< Z position sensor
         int pos; //!< This is the last coordinate read
+        uint32_t time; //!< Time of the last coordinate read (RTC counter, 1/1024s units)
     }pointer;
     
     /// Keyboard data structure
@@ -97,21 +100,45 @@ typedef struct{
     
 }DEVICE_t;
 
+/// Buzzer pattern priority
+typedef enum{
+    BUZZER_PRIORITY_INFO = 0,   //!< Signalling pattern: queued behind the playing pattern
+    BUZZER_PRIORITY_ALARM,      //!< Error pattern: preempts a playing INFO pattern
+}BUZZER_PRIORITY_t;
+
+#define BUZZER_QUEUE_SIZE       4       //!< Max number of pending buzzer patterns
+#define BUZZER_UNIT_us          15625   //!< Pattern time unit (us): the 15.64ms task period
+#define BUZZER_TICK_us          64      //!< TC0 tick (us): GCLK2 1MHz / 64
+
+/// Buzzer pattern
 typedef struct{
-    bool status;
-    int timer;
-    int ton;
-    int toff;
-    int num_pulses;
-    
+    uint8_t pulses;     //!< Number of pulses
+    uint8_t ton;        //!< Pulse ON time (15.625ms units)
+    uint8_t toff;       //!< Pulse OFF time (15.625ms units)
+    uint8_t priority;   //!< Pattern priority (BUZZER_PRIORITY_t)
+}BUZZER_PATTERN_t;
+
+/// Buzzer pattern generator data
+typedef struct{
+    volatile bool status;                       //!< A pattern is playing
+    BUZZER_PATTERN_t pattern;                   //!< Playing pattern
+    volatile unsigned segment;                  //!< Playing segment (even: ON, odd: OFF)
+    BUZZER_PATTERN_t queue[BUZZER_QUEUE_SIZE];  //!< Pending patterns (priority order)
+    volatile unsigned queued;                   //!< Number of pending patterns
 }BUZZER_t;
 
 ext DEVICE_t deviceStruct; 
 ext void SetKeyMode(bool enable, bool step_mode);
+ext uint8_t KeyboardEventGenerator(void);
 ext void SetPowerSwitchStat(bool stat);
 ext void BuzzerSet(int pulses, int ton, int toff);
+ext void BuzzerSetPriority(int pulses, int ton, int toff, BUZZER_PRIORITY_t priority);
 ext void GetX(void);
 ext void GetY(void);
 ext void GetZ(void);
+ext bool PositionSampleGet(CALIB_AXIS_t ax);
+ext bool PositionWindowStart(CALIB_AXIS_t ax, int target_dm);
+ext void PositionWindowStop(void);
+ext void TimingTelemetryReset(void);
 
 #endif // _MOTLIB_H
\ No newline at end of file